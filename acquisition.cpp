@@ -0,0 +1,383 @@
+/* acquisition.cpp - Implements a synchronized acquisition resource
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "acquisition.h"
+#include "frame_file.h"
+#include "interleaved_file.h"
+#include <utils/template.h>
+#include <utils/pgmspace_file.h>
+#include <string.h>
+#include <stdlib.h>
+#include <avr_pal.h>
+
+Acquisition::Acquisition(Channel** channels):
+	Resource(),
+	channels(channels)
+{
+
+}
+
+Response::status_code Acquisition::process(Request* request, Response* response)
+{
+	if(!request->to_destination()) // If the request is at destination.
+	{
+		if(request->is_method(Request::GET)) // If this is a GET request.
+		{
+			// If the frames of the channels cannot be interleaved.
+			if(!compatible())
+			{
+				return SERVICE_UNAVAILABLE_503;
+			}
+
+			File* body = get_frames(); // Retrieve the frames.
+
+			if(body) // If the frames were ready.
+			{
+				// Set the frames as the response's body.
+				response->set_body(body, MIME::APPLICATION_OCTET_STREAM);
+
+				return OK_200;
+			}
+
+			// Queue the request to process it at a later time.
+			if(queue.queue(request))
+			{
+				return SERVICE_UNAVAILABLE_503; // Queue is full.
+			}
+
+			schedule_wakeup(); // Run the resource once the frames are ready.
+
+			return RESPONSE_DELAYED_102;
+		}
+
+		return NOT_IMPLEMENTED_501; // Request method not implemented.
+	}
+	/* If the request is one resource before destionation, it might refer to
+	 * sub resources of the acquisition. */
+	else if(request->to_destination() == 1)
+	{
+		request->next(); // Go to the next resource.
+
+		// If the request is for the parameters resource.
+		if(!strcmp(request->current(), "pr"))
+		{
+			if(request->is_method(Request::POST)) // If it is a POST request.
+			{
+				char buffer[4]; // A buffer to store form data.
+
+				// Find an argument named ts (trigger source).
+				uint8_t len = request->find_arg("ts", buffer, 3);
+
+				if(len) // If there is an argument for the trigger source.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					uint8_t ts = atoi(buffer); // Convert it to an integer.
+
+					// Only existing channels can trigger.
+					Channel::synchronize(ts > NUMBER_OF_CHANNELS ? 0: ts);
+				}
+
+				goto get; // Proceed the rest of the request like a GET.
+			}
+			// If this ia GET request.
+			else if(request->is_method(Request::GET))
+			{
+				get:
+
+				File* body = get_params(); // Get the parameters.
+
+				/* If there was not enough memory to allocate a file to hold
+				 * the parameters JSON array. */
+				if(!body)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// Set the parameters file as the response body.
+				response->set_body(body, MIME::APPLICATION_JSON);
+
+				return OK_200;
+			}
+
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+		}
+
+		/* This url cannot be processed, pass it to child resources. Because
+		 * we jumped to the next resource earlier, the request url needs to be
+		 * rewinded.*/
+		request->previous();
+	}
+
+	return PASS_308; // Cannot process this request.
+}
+
+void Acquisition::run(void)
+{
+	Request* request;
+
+	while((request = queue.peek())) // While requests are waiting for frames.
+	{
+		File* body = NULL;
+
+		// If the request has not timed out and the frames can be sent.
+		if(request->age + max_request_age >= get_uptime())
+		{
+			if(compatible()) // If the frames can still be interleaved.
+			{
+				body = get_frames();
+
+				if(!body) // If the frames are not ready.
+				{
+					schedule_wakeup(); // Sleep until they are.
+
+					return;
+				}
+			}
+		}
+
+		request = queue.dequeue(); // Remove the request from the queue.
+
+		// Craft a response for the request.
+		Response* response = new Response(body ? OK_200:
+			compatible() ? REQUEST_TIMEOUT_408: SERVICE_UNAVAILABLE_503, request);
+
+		if(!response) // If the response could no be allocated.
+		{
+			if(body) { delete body; }
+			delete request; // Drop the request and let the client time out.
+
+			break; // Maybe there will be resources available on the next run.
+		}
+
+		if(body) // If the frames were ready.
+		{
+			// Set the frames as the body.
+			response->set_body(body, MIME::APPLICATION_OCTET_STREAM);
+		}
+
+		dispatch(response); // Dispatch the response to the client.
+	}
+
+	schedule_wakeup();
+}
+
+void Acquisition::wake(void)
+{
+	schedule(0); // Run right away.
+}
+
+void Acquisition::schedule_wakeup(void)
+{
+	Request* request = queue.peek(); // The request that times out first.
+
+	/* The ISR may schedule this resource as well, so interrupts are disabled
+	 * to keep it from doing so while it is being scheduled here. */
+	ATOMIC
+	{
+		// The ISR wakes the resource up when a frame is completed.
+		Channel::waiting_acquisition = request ? this: NULL;
+
+		/* If the frames were frozen before the ISR could wake the resource up
+		 * or the requests could not be answered. */
+		if(request && ready())
+		{
+			schedule(1); // Maybe memory will be available in 1 ms.
+		}
+		else if(request) // If a request is waiting for frames.
+		{
+			uptime_t deadline = request->age + max_request_age;
+			uptime_t now = get_uptime();
+
+			// Run the resource when it times out.
+			schedule(deadline >= now ? deadline - now + 1: 1);
+		}
+		else
+		{
+			schedule(NEVER); // Nothing to do until frames are needed.
+		}
+	}
+}
+
+bool Acquisition::ready(void)
+{
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		uint8_t frame = !channels[i]->acquiring;
+
+		// If the frame is not ready or was not frozen with the others.
+		if(!(channels[i]->trigger_flags & DONE_SAMPLE) ||
+			channels[i]->frame_syncs[frame] !=
+			channels[0]->frame_syncs[!channels[0]->acquiring])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool Acquisition::compatible(void)
+{
+	if(!Channel::leader) // If each channel triggers on its own.
+	{
+		return false;
+	}
+
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		/* If the channel is not converted or its frames are not laid out
+		 * like the first one's. */
+		if(!channels[i]->enabled || !channels[i]->record_length ||
+			channels[i]->mode == ROLL_MODE ||
+			channels[i]->record_length != channels[0]->record_length ||
+			channels[i]->resolution != channels[0]->resolution ||
+			channels[i]->decimation != channels[0]->decimation ||
+			channels[i]->mode != channels[0]->mode)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+File* Acquisition::get_frames(void)
+{
+	uint8_t frames[NUMBER_OF_CHANNELS];
+	bool frozen;
+
+	ATOMIC
+	{
+		frozen = ready();
+
+		if(frozen) // If the frames can be sent.
+		{
+			for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+			{
+				/* Reference the ready frames so the ISR does not switch to
+				 * them until the files are deleted. */
+				frames[i] = !channels[i]->acquiring;
+				channels[i]->references[frames[i]]++;
+				channels[i]->frame_read = true;
+			}
+		}
+	}
+
+	if(!frozen)
+	{
+		return NULL;
+	}
+
+	File* files[NUMBER_OF_CHANNELS];
+	uint8_t leader = 0;
+	uint8_t i;
+
+	for(i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		Channel* channel = channels[i];
+
+		// In 10 bits, frames start on a group of 4 samples.
+		uint16_t start = channel->resolution == 10 ?
+			channel->frame_starts[frames[i]] / 4 * 5:
+			channel->frame_starts[frames[i]];
+
+		files[i] = new PooledFrameFile(channel->frames[frames[i]],
+			channel->frame_size(), start, &channel->references[frames[i]]);
+
+		if(!files[i]) // If the file could not be allocated.
+		{
+			break;
+		}
+
+		if(channel == Channel::leader)
+		{
+			leader = i + 1;
+		}
+	}
+
+	File* f = NULL;
+
+	if(i == NUMBER_OF_CHANNELS) // If every frame was wrapped into a file.
+	{
+		f = new PooledInterleavedFile(files, channels[0]->resolution,
+			channels[0]->record_length, leader);
+
+		if(f)
+		{
+			return f;
+		}
+	}
+
+	// Not enough memory, release the frames.
+	for(uint8_t j = 0; j < NUMBER_OF_CHANNELS; j++)
+	{
+		if(j < i)
+		{
+			delete files[j]; // Releases the reference.
+		}
+		else
+		{
+			channels[j]->references[frames[j]]--; // Was never wrapped.
+		}
+	}
+
+	return NULL;
+}
+
+/// The template that contains the parameters.
+#define CONTENT "{\"ts\":~,\"ch\":~}"
+
+/// The length of the template string.
+#define CONTENT_SIZE sizeof(CONTENT) - 1
+
+/// The parameter template stored in program memory.
+static const char content_P[] PROGMEM = CONTENT;
+
+File* Acquisition::get_params(void)
+{
+	// Create a file to hold the parameter program memory string..
+	File* f = new PooledPGMSpaceFile(content_P, CONTENT_SIZE);
+
+	if(!f) // If there was no memory left for the file.
+	{
+		return NULL; // Cannot proceed.
+	}
+
+	Template* t = new PooledTemplate(f); // Create a template.
+
+	if(!t) // If there was no memory left for the template.
+	{
+		delete f; // Delete the file.
+		return NULL; // Cannot proceed.
+	}
+
+	uint8_t ts = 0;
+
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		if(channels[i] == Channel::leader) // If this channel triggers.
+		{
+			ts = i + 1;
+		}
+	}
+
+	t->add_narg(ts); // Add the template arguments.
+	t->add_narg(NUMBER_OF_CHANNELS);
+
+	return t;
+}
@@ -0,0 +1,111 @@
+/* acquisition.h - Implements a synchronized acquisition resource
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACQUISITION_H_
+#define ACQUISITION_H_
+
+#include <core/resource.h>
+#include "channel.h"
+
+/**
+ * This resource gives the frames of every channel acquired at the same time.
+ * The following are the list of sub-resources defined inside the class:
+ * - /: interleaved sample data octet stream (see InterleavedFile)
+ * - /pr: parameters JSON array (GET)
+ *    - ts: trigger source, the number of the channel whose trigger freezes
+ *      the frames of every channel, 0 so each channel triggers on its own
+ *      (argument)
+ *    - ch: the number of channels of the oscilloscope
+ *
+ * Frames are only given while the channels are synchronized, enabled and have
+ * the same record length, decimation, resolution and acquisition mode.
+ * */
+class Acquisition: public Resource
+{
+	protected:
+
+		/// The delay after which a request expires.
+		static const uptime_t max_request_age = 1000;
+
+		/// The channels of the oscilloscope.
+		Channel** channels;
+
+		/// The queue were requests are kept.
+		Queue<Request*> queue;
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param channels the NUMBER_OF_CHANNELS channels of the oscilloscope.
+		 * */
+		Acquisition(Channel** channels);
+
+		/**
+		 * Schedule the resource to run right away. This method is meant to be
+		 * called from the ADC's interrupt service routine once a frame is
+		 * completed.
+		 * */
+		void wake(void);
+
+	protected:
+
+        /// Process a request message.
+        /**
+         * @param request the request to process.
+         * @param response the response to fill if a response should be returned (which
+         * depends on the status code).
+         * @return the status_code produced while processing the request.
+         */
+		virtual Response::status_code process(Request* request, Response* response);
+
+		/// Does processing on the resource.
+		virtual void run(void);
+
+		/**
+		 * Schedule the resource so it sleeps until a frame is completed or
+		 * the oldest request waiting for frames times out.
+		 * */
+		void schedule_wakeup(void);
+
+		/**
+		 * Must be called with interrupts disabled.
+		 * @return if the ready frames of every channel were frozen together.
+		 * */
+		bool ready(void);
+
+		/**
+		 * @return if the channels are synchronized and their frames can be
+		 * interleaved.
+		 * */
+		bool compatible(void);
+
+		/**
+		 * Get the frames of every channel frozen at the same scan.
+		 * @return a file interleaving the frames, NULL if they are not ready
+		 * or there was not enough memory.
+		 * */
+		File* get_frames(void);
+
+		/**
+		 * Get the current parameters for the acquisition.
+		 * @return a file containing the parameters.
+		 * */
+		File* get_params(void);
+};
+
+#endif /* ACQUISITION_H_ */
@@ -0,0 +1,116 @@
+/* assets.cpp - Implements a resource serving the web assets from program memory
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "assets.h"
+#include "web_assets.h"
+#include "pool.h"
+#include <string.h>
+#include <avr/pgmspace.h>
+
+/// The number of assets mirrored in program memory.
+#define NUMBER_OF_ASSETS (sizeof(assets_P) / sizeof(asset_t))
+
+/// The longest entity tag, quotes included.
+#define ETAG_LENGTH 10
+
+Assets::Assets(void):
+	Resource()
+{}
+
+Response::status_code Assets::process(Request* request, Response* response)
+{
+	// If the request is for an asset.
+	if(request->to_destination() == 1)
+	{
+		request->next(); // Go to the asset's name.
+
+		asset_t asset;
+		uint8_t i;
+
+		for(i = 0; i < NUMBER_OF_ASSETS; i++)
+		{
+			memcpy_P(&asset, &assets_P[i], sizeof(asset_t));
+
+			if(!strcmp_P(request->current(), asset.name))
+			{
+				break;
+			}
+		}
+
+		if(i == NUMBER_OF_ASSETS) // If the asset is not mirrored.
+		{
+			/* Because we jumped to the next resource earlier, the request
+			 * url needs to be rewinded.*/
+			request->previous();
+
+			return PASS_308; // Cannot process this request.
+		}
+
+		if(!request->is_method(Request::GET))
+		{
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+		}
+
+		response->add_header("ETag", asset.etag);
+
+		// The page is checked every time, the assets it refers to never.
+		response->add_header("Cache-Control", asset.type == ASSET_XHTML ?
+			"no-cache": "max-age=31536000, immutable");
+
+		char buffer[ETAG_LENGTH + 1]; // A buffer to store the client's tag.
+
+		// Find the entity tag of the copy the client has.
+		uint8_t len = request->find_header("If-None-Match", buffer, ETAG_LENGTH);
+
+		if(len) // If the client has a copy.
+		{
+			buffer[len] = '\0'; // Terminate the string.
+
+			if(!strcmp(buffer, asset.etag)) // If it is up to date.
+			{
+				return NOT_MODIFIED_304;
+			}
+		}
+
+		// The asset is sent from program memory as it is stored.
+		File* body = new PooledPGMSpaceFile(
+			(const char*)asset.data, asset.size);
+
+		if(!body) // If there was not enough memory to allocate the file.
+		{
+			// Not enough resources to process the request.
+			return SERVICE_UNAVAILABLE_503;
+		}
+
+		MIME::Type type;
+
+		switch(asset.type)
+		{
+			case ASSET_CSS: type = MIME::TEXT_CSS; break;
+			case ASSET_JAVASCRIPT: type = MIME::APPLICATION_JAVASCRIPT; break;
+			default: type = MIME::APPLICATION_XHTML_XML;
+		}
+
+		response->set_body(body, type);
+
+		response->add_header("Content-Encoding", "gzip");
+
+		return OK_200;
+	}
+
+	return PASS_308; // Cannot process this request.
+}
@@ -0,0 +1,78 @@
+/* assets.h - Implements a resource serving the web assets from program memory
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASSETS_H_
+#define ASSETS_H_
+
+#include <core/resource.h>
+
+/// The type of an asset, which gives its MIME type and how long it is cached.
+#define ASSET_XHTML 0
+#define ASSET_CSS 1 ///< See ASSET_XHTML.
+#define ASSET_JAVASCRIPT 2 ///< See ASSET_XHTML.
+
+/// An asset mirrored in program memory, see web/make_assets.py.
+struct asset_t
+{
+	/// The name of the asset in the url.
+	const char* name;
+
+	/// The content of the asset compressed with gzip.
+	const uint8_t* data;
+
+	/// The length of the content.
+	uint16_t size;
+
+	/** The entity tag of the content, a quoted string. It is kept in RAM so
+	 * it outlives the responses it is added to as a header. */
+	const char* etag;
+
+	/// ASSET_XHTML, ASSET_CSS or ASSET_JAVASCRIPT.
+	uint8_t type;
+};
+
+/**
+ * This resource serves the web interface from program memory, so loading a
+ * page does not read the EEPROM over I2C while frames are being sent.
+ * The following are the list of sub-resources defined inside the class:
+ * - /<name>: an asset compressed with gzip (GET). Its entity tag is a hash of
+ *   its content and a request whose If-None-Match header matches it gets a
+ *   304. The page is revalidated on every load, the other assets are cached
+ *   for good since the page refers to them with their entity tag.
+ *
+ * The assets are generated from the files in web/ by web/make_assets.py.
+ * */
+class Assets: public Resource
+{
+	public:
+
+		/// Class constructor.
+		Assets(void);
+
+	protected:
+
+        /// Process a request message.
+        /**
+         * @param request the request to process.
+         * @param response the response to fill if a response should be returned (which
+         * depends on the status code).
+         * @return the status_code produced while processing the request.
+         */
+		virtual Response::status_code process(Request* request, Response* response);
+};
+
+#endif /* ASSETS_H_ */
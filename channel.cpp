@@ -16,24 +16,158 @@
  */
 
 #include "channel.h"
+#include "frame_file.h"
+#include "delta_frame_file.h"
+#include "stream_file.h"
+#include "acquisition.h"
+#include "frame_header_file.h"
+#include "spectrum_file.h"
+#include "interleaved_file.h"
+#include "stats.h"
 #include <utils/template.h>
-#include <utils/memfile.h>
 #include <utils/pgmspace_file.h>
 #include <string.h>
 #include <avr/io.h>
 #include <stdlib.h>
 #include <avr_pal.h>
 
+#if NUMBER_OF_CHANNELS > 6
+	#error "The ADC only has 6 inputs with a digital input buffer to disable."
+#endif
+
+#ifdef __AVR__
+/* The channels live on the stack of main(), the build fails if they take
+ * more RAM than they are given since they would run over the heap. Pointers
+ * are wider on other targets, so this is only checked on the MCU. */
+typedef char channels_fit_in_ram
+	[sizeof(Channel) * NUMBER_OF_CHANNELS <= CHANNELS_RAM_BUDGET ? 1: -1];
+
+/// The pools of files are static, they must fit in their own budget.
+typedef char file_pools_fit_in_ram
+	[PooledPGMSpaceFile::ram + PooledTemplate::ram + PooledFrameFile::ram +
+	PooledDeltaFrameFile::ram + PooledFrameHeaderFile::ram +
+	PooledSpectrumFile::ram + PooledInterleavedFile::ram <=
+	FILE_POOLS_RAM_BUDGET ? 1: -1];
+#endif
+
+#if FRAME_FILE_POOL_COUNT < NUMBER_OF_CHANNELS
+	#error "/all takes a frame file of every channel from their pool."
+#endif
+
 /// Oscilloscope channels are stored in this array to be accessed by the ISR.
 static Channel* instances[NUMBER_OF_CHANNELS];
 
+/// The ADC input of each channel.
+static const uint8_t channel_inputs_P[] PROGMEM = CHANNEL_INPUTS;
+
+/** The enabled channels, in the order the ADC converts them. Disabled
+ * channels are left out so the others share the conversions. */
+static Channel* scan[NUMBER_OF_CHANNELS];
+
+/// The ADC input of each channel in the scan.
+static uint8_t scan_inputs[NUMBER_OF_CHANNELS];
+
+/// The number of channels in the scan.
+static uint8_t scan_length = 0;
+
+/// The position in the scan of the channel being converted.
+static uint8_t scan_ptr = 0;
+
+/** The number of CPU cycles an auto-triggered ADC conversion takes with a
+ * prescaler of 128 (13.5 ADC clock cycles). */
+#define CONVERSION_CYCLES (128 * 27 / 2)
+
+/// The highest sampling rate per channel the ADC can sustain.
+#define MAX_SAMPLING_RATE \
+	(F_CPU / CONVERSION_CYCLES / (scan_length ? scan_length: 1))
+
+/// The division factors of timer 1, indexed by their CS1x bits minus one.
+static const uint16_t timer_prescalers_P[] PROGMEM = { 1, 8, 64, 256, 1024 };
+
+/// The division factor timer 1 is running with, to time the ISR.
+static uint16_t timer_prescaler = 1;
+
+uint16_t Channel::sampling_rate;
+
+Channel* Channel::leader = NULL;
+
+Acquisition* volatile Channel::waiting_acquisition = NULL;
+
+uint16_t Channel::sync_sequence = 0;
+
 Channel::Channel(uint8_t number):
 	Resource(),
-	// Initialize as if we already have samples stored.
-	sample_ptr(extra_space + 1),
+	number(number),
+	input(pgm_read_byte(&channel_inputs_P[number - 1])),
+	enabled(true),
+	record_length(0), // The frames are not allocated yet.
+	decimation(1),
+	resolution(8),
+	mode(NORMAL_MODE),
+	sample_ptr(0),
+	group_ptr(0),
+	samples_left(0),
+	// In a frame of 100 samples, keep the two the trigger is verified against.
+	trigger_position(2),
+	pre_trigger(0),
+	alignment_mask(0),
+	arming_length(0),
+	pre_trigger_left(0),
+	acquiring(0),
+	sequence(0),
+	rolled(0),
+	roll_length(0),
+	last_sample(0),
+	before_last_sample(0),
+	kernel(&Channel::idle), // Nothing to store samples in yet.
+	decimated_kernel(&Channel::idle),
+	kernel_slot(&kernel),
+	armed_kernel(&Channel::idle),
+	accumulator(0),
+	minimum(0xFFFF),
+	maximum(0),
+	decimation_left(1),
+	decimation_shift(0),
 	trigger_flags(0),
-	trigger_level(128)
+	trigger_level(128),
+	trigger_threshold(128 << 2),
+	sweeps(1), // Frames are not averaged.
+	sweeps_shift(0),
+	sweeps_left(1),
+	sums(NULL),
+	average(NULL),
+	average_references(0),
+	summed_sequence(0),
+	average_sequence(0),
+	average_ready(false),
+	interleave(1), // Frames are not interleaved.
+	interleaved_bins(0),
+	measured(false),
+	segments(NULL),
+	segment_info(NULL),
+	segment_count(0),
+	segments_filled(0),
+	segment_references(0),
+	completing(false),
+	dropping(false),
+	wake_on_frame(false),
+	dropped(0),
+	frame_read(false),
+	armed_samples(0),
+	average_time(0)
 {
+	references[0] = references[1] = 0; // No frame is being sent.
+	frame_starts[0] = frame_starts[1] = 0;
+	frames[0] = frames[1] = NULL;
+	buffers[0] = buffers[1] = NULL;
+	trigger_ptrs[0] = trigger_ptrs[1] = NO_TRIGGER;
+	frame_times[0] = frame_times[1] = 0;
+	frame_syncs[0] = frame_syncs[1] = 0;
+	memset(&stats, 0, sizeof(stats)); // Nothing was counted yet.
+
+	// Allocate the frames, this also starts acquisition.
+	configure_frames(default_record_length, resolution);
+
 	// Store of reference to this channel for acces by the ISR.
 	instances[number - 1] = this;
 
@@ -45,18 +179,24 @@ Channel::Channel(uint8_t number):
 		 * a read-modify-write while a conversion is running.*/
 
 		ADMUX = _BV(REFS0) +  // Using AVcc with external capacitor at AREF pin.
-				_BV(ADLAR) + // Left adjustment for 8 bit precision necessary.
-				NUMBER_OF_CHANNELS - 1; // Conversion starts with the last channel.
+				/* Right adjustment, the ISR reads all 10 bits and each channel
+				 * keeps the ones its resolution needs. */
+				0;
+
+		scan_channels(); // Conversion starts with the first channel.
+
+		// Conversions are started by a timer 1 compare match B.
+		ADCSRB = _BV(ADTS2) + _BV(ADTS0);
 
 		ADCSRA = _BV(ADEN) +  // Enables the ADC.
-				_BV(ADSC) +  // Start a conversion.
 				_BV(ADATE) +  // Auto-trigger enabled.
 				_BV(ADIE) +  // Interrupt enable.
-				// Prescaler at 128 (See sampling_rate below).
+				// Prescaler at 128 (See CONVERSION_CYCLES above).
 				_BV(ADPS2) + _BV(ADPS1) + _BV(ADPS0);
+
+		// Start sampling as fast as the ADC allows.
+		sampling_rate = set_sampling_rate(MAX_SAMPLING_RATE);
 	}
-	 // Value derived from instructions below.
-	sampling_rate = 9616 / NUMBER_OF_CHANNELS;
 
 	/*An ADC conversion takes 13 cycles by default, here is a list giving the conversion rates
 	 * with F_CPU = 16 MHz
@@ -71,25 +211,212 @@ Channel::Channel(uint8_t number):
 	 * Since we are alternating between channels, the sampling rate is also affected
 	 * by the number of active channels at any given time.
 	 *
-	 * This is in free running mode. To get a precise conversion rate, we should be
-	 * starting the conversion on a timer. It is also important to note that prescalers
-	 * 2, 4 are too fast for the firmware to process and that prescaler 8 would be a
-	 * severe hit on performance. This could be mitigated by doing sample storing
-	 * in assembly or using very optimized static code.
+	 * Conversions are started by timer 1 so samples are evenly spaced at the
+	 * requested rate. An auto-triggered conversion takes half an ADC cycle
+	 * more, which caps the rate at about 9259 conversions per second. It is
+	 * also important to note that prescalers 2, 4 are too fast for the firmware
+	 * to process and that prescaler 8 would be a severe hit on performance.
+	 * This could be mitigated by doing sample storing in assembly or using very
+	 * optimized static code.
 	 * */
 
-	// Nothing to set in ADCSRB.
-
-	// Disable the digital input on the ADC pin.
-	/// TODO the pin should change with the channel.
-	DIDR0 = _BV(ADC0D);
+	// Disable the digital input on the channel's ADC pin.
+	DIDR0 |= _BV(input);
 
 	VERBOSE_PRINTLN_P("Channel ready...");
 
 }
 
+void Channel::scan_channels(void)
+{
+	scan_length = 0;
+
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		if(instances[i]->enabled) // If the channel is converted.
+		{
+			scan[scan_length] = instances[i];
+			scan_inputs[scan_length] = instances[i]->input;
+			scan_length++;
+		}
+	}
+
+	/* Start the scan over with the first channel. A conversion that was
+	 * already running ends up in that channel's frame. */
+	scan_ptr = 0;
+
+	if(scan_length)
+	{
+		ADMUX = (ADMUX & 0xF0) | scan_inputs[0];
+	}
+}
+
+uint16_t Channel::set_sampling_rate(uint16_t rate)
+{
+	if(!rate) // If the rate is null.
+	{
+		rate = 1; // Use the slowest rate instead.
+	}
+	else if(rate > MAX_SAMPLING_RATE) // If the ADC cannot go that fast.
+	{
+		rate = MAX_SAMPLING_RATE;
+	}
+
+	// The number of channels converted in turn.
+	uint8_t channels = scan_length ? scan_length: 1;
+
+	// The rate at which the timer must start conversions.
+	uint32_t conversion_rate = (uint32_t)rate * channels;
+
+	uint8_t i = 0;
+	uint16_t prescaler;
+	uint32_t ticks;
+
+	/* Find the smallest prescaler for which the period fits in the 16 bits of
+	 * the compare register, it gives the finest resolution on the period. */
+	while(true)
+	{
+		prescaler = pgm_read_word(&timer_prescalers_P[i]);
+
+		// The number of timer ticks between conversions, rounded.
+		ticks = (F_CPU / prescaler + conversion_rate / 2) / conversion_rate;
+
+		// If the period fits or if this is the largest prescaler.
+		if(ticks <= 0x10000 || i == sizeof(timer_prescalers_P) / sizeof(uint16_t) - 1)
+		{
+			break;
+		}
+
+		i++;
+	}
+
+	if(ticks > 0x10000) // If the period is still too long.
+	{
+		ticks = 0x10000;
+	}
+
+	ATOMIC // 16 bits timer registers must not be accessed from an interrupt.
+	{
+		TCCR1B = 0; // Stop the timer while it gets configured.
+		TCCR1A = 0;
+		TCNT1 = 0;
+		OCR1A = ticks - 1; // The TOP value of the timer.
+		OCR1B = ticks - 1; // Compare match B starts a conversion.
+		TIFR1 = _BV(OCF1B); // Clear a pending compare match.
+		/* Clear timer on compare match mode with OCR1A as TOP and the prescaler
+		 * whose CS1x bits are its index plus one. */
+		TCCR1B = _BV(WGM12) + i + 1;
+
+		timer_prescaler = prescaler;
+	}
+
+	// Compute the rate actually achieved, rounded.
+	conversion_rate = (uint32_t)prescaler * ticks * channels;
+
+	return (F_CPU + conversion_rate / 2) / conversion_rate;
+}
+
+uint32_t Channel::frame_rate(uint16_t rate, uint8_t shift)
+{
+	// Decimated rates go under 1 Hz, millihertz keep them from truncating.
+	return (uint32_t)rate * 1000 >> shift;
+}
+
+File* Channel::get_roll(uint16_t from, bool all)
+{
+	frame_header_t header;
+
+	header.version = FRAME_HEADER_VERSION;
+	header.channel = number;
+	header.flags = FRAME_ROLL;
+	header.resolution = resolution;
+	header.rate = frame_rate(sampling_rate, decimation_shift);
+	header.trigger = NO_TRIGGER; // Roll mode does not trigger.
+	header.timestamp = get_uptime();
+
+	uint8_t frame;
+	uint8_t count; // The number of samples sent.
+	uint8_t position; // The position of the first one in the frame.
+
+	ATOMIC
+	{
+		// Only complete groups of 4 samples are sent in 10 bits.
+		uint16_t end = rolled & ~alignment_mask;
+
+		/* The samples in the history, without those of the group being
+		 * acquired, which overwrites the oldest ones. */
+		uint8_t available = (roll_length - (rolled - end)) & ~alignment_mask;
+
+		/* Once the history is full, the group at sample_ptr is the oldest and
+		 * the next one overwritten, in 10 bits along with the byte its samples
+		 * share. It is held back so it does not change while it is read. */
+		if(available > record_length - alignment_mask - 1)
+		{
+			available = record_length - alignment_mask - 1;
+		}
+
+		from &= ~alignment_mask;
+
+		// If the client is too far behind to only get the new samples.
+		if(all || (uint16_t)(end - from) > available)
+		{
+			from = end - available;
+		}
+
+		count = end - from;
+
+		// How far back in the history the first sample is.
+		uint8_t back = rolled - from;
+
+		position = sample_ptr >= back ?
+			sample_ptr - back: sample_ptr + record_length - back;
+
+		/* Reference the frame being acquired so it does not get reallocated
+		 * until the file is deleted, the ISR keeps rolling in it. */
+		frame = acquiring;
+		references[frame]++;
+
+		header.dropped = dropped;
+	}
+
+	header.sequence = from;
+	header.record_length = count;
+
+	size_t start = position;
+	size_t bytes = count;
+
+	if(resolution == 10) // If samples are packed in groups of 4.
+	{
+		start = start / 4 * 5;
+		bytes = bytes / 4 * 5;
+	}
+
+	/* A file over an empty frame is sent if there are no new samples, since
+	 * reading no bytes would read the whole frame. */
+	FrameFile* f = new PooledFrameFile(frames[frame],
+		bytes ? frame_size(): 0, start, &references[frame], bytes);
+
+	if(!f) // If the file could not be allocated.
+	{
+		references[frame]--; // The frame is not referenced.
+
+		return NULL; // Not enough memory to proceed.
+	}
+
+	// Send the metadata of the samples before them.
+	File* h = new PooledFrameHeaderFile(f, header);
+
+	if(!h) // If the file could not be allocated.
+	{
+		delete f; // Releases the frame.
+	}
+
+	return h;
+}
+
 /// The template that contains the parameters.
-#define CONTENT "{\"sr\":~,\"tf\":~,\"tl\":~}"
+#define CONTENT "{\"sr\":~,\"tf\":~,\"tl\":~,\"pt\":~,\"rl\":~,\"dc\":~," \
+	"\"rs\":~,\"am\":~,\"av\":~,\"et\":~,\"en\":~,\"sg\":~}"
 
 /// The length of the template string.
 #define CONTENT_SIZE sizeof(CONTENT) - 1
@@ -100,14 +427,14 @@ static const char content_P[] PROGMEM = CONTENT;
 File* Channel::get_params(void)
 {
 	// Create a file to hold the parameter program memory string..
-	File* f = new PGMSpaceFile(content_P, CONTENT_SIZE);
+	File* f = new PooledPGMSpaceFile(content_P, CONTENT_SIZE);
 
 	if(!f) // If there was no memory left for the file.
 	{
 		return NULL; // Cannot proceed.
 	}
 
-	Template* t = new Template(f); // Create a template.
+	Template* t = new PooledTemplate(f); // Create a template.
 
 	if(!t) // If there was no memory left for the template.
 	{
@@ -119,364 +446,2507 @@ File* Channel::get_params(void)
 	t->add_narg(sampling_rate);
 	t->add_narg(trigger_flags);
 	t->add_narg(trigger_level);
+	t->add_narg(trigger_position);
+	t->add_narg(record_length);
+	t->add_narg(decimation);
+	t->add_narg(resolution);
+	t->add_narg(mode);
+	t->add_narg(sweeps);
+	t->add_narg(interleave);
+	t->add_narg(enabled);
+	t->add_narg(segment_count);
 
 	return t;
 }
 
-Response::status_code Channel::process(Request* request, Response* response)
-{
-	if(!request->to_destination()) // If the request is at destination.
-	{
-			if(request->is_method(Request::GET)) // If this is a GET request.
-			{
-				if(sample_ptr > sample_size) // If a sample is ready.
-				{
-					File* body = get_sample(); // Retrieve the sample.
+/// The template that contains the state of the segments.
+#define SEGMENTS "{\"sg\":~,\"n\":~}"
 
-					// If there was not enough memory to allocated the file.
-					if(!body)
-					{
-						// Not enough resources to process the request.
-						return SERVICE_UNAVAILABLE_503;
-					}
+/// The length of the segments template string.
+#define SEGMENTS_SIZE sizeof(SEGMENTS) - 1
 
-					// Set the sample file as the response's body.
-					response->set_body(body, MIME::APPLICATION_OCTET_STREAM);
+/// The segments template stored in program memory.
+static const char segments_P[] PROGMEM = SEGMENTS;
 
-					VERBOSE_PRINTLN_P("Sample ready");
+File* Channel::get_segment(uint8_t index)
+{
+	const segment_t* info = segment_info + index;
+	frame_header_t header;
 
-					return OK_200;
-				}
-				else // If there is no sample ready yet.
-				{
-					// Queue the request to process it at a later time.
-					if(queue.queue(request))
-					{
-						return SERVICE_UNAVAILABLE_503; // Queue is full.
-					}
+	// The segment keeps the parameters it was acquired with.
+	header.version = FRAME_HEADER_VERSION;
+	header.channel = number;
+	header.flags = FRAME_SEGMENT | info->flags;
+	header.resolution = resolution;
+	header.sequence = index;
+	header.timestamp = info->time;
+	header.rate = frame_rate(info->rate, info->decimation_shift);
+	header.record_length = record_length;
+	header.trigger = info->trigger;
 
-					VERBOSE_PRINTLN_P("Sample not ready ");
+	ATOMIC { header.dropped = dropped; }
 
-					schedule(1); // Run the resource in 1 ms.
+	/* Reference the segments so they do not get reallocated until the file
+	 * is deleted. The filled ones are never overwritten. */
+	segment_references++;
 
-					return RESPONSE_DELAYED_102;
-				}
-			}
+	// In 10 bits, frames start on a group of 4 samples.
+	uint16_t start = resolution == 10 ? info->start / 4 * 5: info->start;
 
-			return NOT_IMPLEMENTED_501; // Request method not implemented.
+	FrameFile* f = new PooledFrameFile(segments + index * frame_size(),
+		frame_size(), start, &segment_references);
 
-	}
-	/* If the request is one resource before destionation, it might refer to
-	 * sub resources of the channel. */
-	else if(request->to_destination() == 1)
+	if(!f) // If the file could not be allocated.
 	{
-		request->next(); // Go to the next resource.
-
-		// If the request is for the parameters resource.
-		if(!strcmp(request->current(), "pr"))
-		{
-			if(request->is_method(Request::POST)) // If it is a POST request.
-			{
-				char buffer[8]; // A buffer to store form data.
-
-				// Find an argument named sr (sampling rate).
-				uint8_t len = request->find_arg("sr", buffer, 7);
+		segment_references--; // The segments are not referenced.
 
-				if(len) // If there is an argument for the sampling rate.
-				{
-					buffer[len] = '\0'; // Terminate the string.
-					// Convert it to an integer and set it.
-					sampling_rate = atoi(buffer);
-				}
+		return NULL; // Not enough memory to proceed.
+	}
 
-				// Find an argument named tl (trigger level).
-				len = request->find_arg("tl", buffer, 7);
+	// Send the metadata of the segment before it.
+	File* h = new PooledFrameHeaderFile(f, header);
 
-				if(len) // If there is an argument for the trigger level.
-				{
-					buffer[len] = '\0'; // Terminate the string.
-					// Convert it to an integer and set it.
-					ATOMIC { trigger_level = atoi(buffer); }
-				}
+	if(!h) // If the file could not be allocated.
+	{
+		delete f; // Releases the segments.
+	}
 
-				// Find an argument named tf (trigger flags).
-				len = request->find_arg("tf", buffer, 7);
+	return h;
+}
 
-				if(len) // If there is an argument for the trigger flags.
-				{
-					buffer[len] = '\0'; // Terminate the string.
-					// Convert it to an integer and set it.
-					ATOMIC { trigger_flags = atoi(buffer); }
-				}
+/// The template that contains the measurements.
+#define MEASUREMENTS "{\"sq\":~,\"fr\":~,\"pd\":~,\"pp\":~,\"mn\":~," \
+	"\"mx\":~,\"av\":~,\"rm\":~,\"dt\":~}"
 
-				goto get; // Proceed the rest of the request like a GET.
-			}
-			// If this ia GET request.
-			else if(request->is_method(Request::GET))
-			{
-				get:
+/// The length of the measurements template string.
+#define MEASUREMENTS_SIZE sizeof(MEASUREMENTS) - 1
 
-				File* body = get_params(); // Get the parameters for this channel.
+/// The measurements template stored in program memory.
+static const char measurements_P[] PROGMEM = MEASUREMENTS;
 
-				/* If there was not enough memory to allocate a file to hold
-				 * the parameters JSON array. */
-				if(!body)
-				{
-					// Not enough resources to process the request.
-					return SERVICE_UNAVAILABLE_503;
-				}
+File* Channel::get_measurements(void)
+{
+	// If the frame that is ready was not measured yet.
+	if(!measured || measurements.sequence != frame_sequence())
+	{
+		measure();
+	}
 
-				// Set the parameters file as the response body.
-				response->set_body(body, MIME::APPLICATION_JSON);
+	// Create a file to hold the measurements program memory string.
+	File* f = new PooledPGMSpaceFile(measurements_P, MEASUREMENTS_SIZE);
 
-				return OK_200;
-			}
+	if(!f) // If there was no memory left for the file.
+	{
+		return NULL; // Cannot proceed.
+	}
 
-			return NOT_IMPLEMENTED_501; // Request method not implemented.
-		}
+	Template* t = new PooledTemplate(f); // Create a template.
 
-		/* This url cannot be processed, pass it to child resources. Because
-		 * we jumped to the next resource earlier, the request url needs to be
-		 * rewinded.*/
-		request->previous();
+	if(!t) // If there was no memory left for the template.
+	{
+		delete f; // Delete the file.
+		return NULL; // Cannot proceed.
 	}
 
-	return PASS_308; // Cannot process this request.
+	// Add the template arguments.
+	t->add_narg(measurements.sequence);
+	t->add_narg(measurements.frequency);
+	t->add_narg(measurements.period);
+	t->add_narg(measurements.max - measurements.min);
+	t->add_narg(measurements.min);
+	t->add_narg(measurements.max);
+	t->add_narg(measurements.mean);
+	t->add_narg(measurements.rms);
+	t->add_narg(measurements.duty);
+
+	return t;
 }
 
-File* Channel::get_sample(void)
+/**
+ * Compute the square root of an integer.
+ * @param value the integer.
+ * @return the square root, rounded down.
+ * */
+static uint16_t square_root(uint32_t value)
 {
-	// Allocate a buffer to hold the current sample.
-	char* sample = (char*)ts_malloc(sample_size);
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30; // The highest power of 4 that fits.
 
-	if(!ssample) // If the buffer could not be allocated.
+	while(bit > value)
 	{
-		return NULL; // Not enough memory to proceed.
+		bit >>= 2;
 	}
 
-	ATOMIC
+	// Find the bits of the root from the most significant one.
+	while(bit)
 	{
-		// Copy the statically allocated buffer into the newly allocated one.
-		memcpy(sample, sample_buffer, sample_size);
-	}
-
-	// Wrap the sample into a file.
-	MemFile* f = new MemFile(sample, sample_size, false);
+		if(value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
 
-	if(!f) // If the file could not be allocated.
-	{
-		ts_free(s); // The sample is lost.
-		// return NULL; // f will be null.
-		// Not enough memory to proceed.
+		bit >>= 2;
 	}
 
-	return f;
+	return root;
 }
 
-
-void Channel::run(void)
+void Channel::measure(void)
 {
-	Request* request = NULL;
+	const uint8_t* data;
+	uint16_t start;
+	volatile uint8_t* counter; // The reference count of the frame.
 
-	VERBOSE_PRINTLN_P("Channel run ");
+	/* The number of samples per second in the frame before the decimation,
+	 * which is applied to the span of the periods instead so decimated rates
+	 * under 1 Hz do not truncate to 0. */
+	uint32_t rate = sampling_rate;
 
-	/* Remove the requests that have time out from the queue an get to the
-	 * request to which the sample needs to be sent.*/
-	while(true)
+	if(mode == PEAK_DETECT_MODE) // If there are two samples per interval.
 	{
-		///TODO move the next line into the loop condition.
-
-		request = queue.peek(); // Is there a request waiting for a sample?
-
-		if(!request) // If there is no waiting request.
-		{
-			break; // Nothing else to do.
-		}
-
-		// If the request has timed out.
-		if(request->age + max_request_age < get_uptime())
-		{
-			VERBOSE_PRINTLN_P("Request too old");
+		rate *= 2;
+	}
 
-			request = queue.dequeue(); // Remove the request from the queue.
+	if(sums) // If frames are combined before being published.
+	{
+		// Reference the average so it does not get replaced while measured.
+		average_references++;
 
-			// Craft a response to inform the client his request has timed out.
-			Response* response = new Response(REQUEST_TIMEOUT_408, request);
-			if(!response) // If the response could no be allocated.
-			{
-				delete request; // Get rid of the request.
+		data = average;
+		start = 0;
+		counter = &average_references;
 
-				// Nothing more we can do, let the client time out at its end.
-				return;
-			}
+		measurements.sequence = average_sequence;
 
-			dispatch(response); // Dispatch the response to the client.
-		}
-		else // Process that request.
+		if(interleaved()) // If the frame is a composite.
 		{
-			VERBOSE_PRINTLN_P("No Request too old");
-			break; // Keep the current requests in the queue.
+			rate *= interleave;
 		}
 	}
-	// If there is a request waiting for a sample and one is ready.
-	if(request && trigger_flags & DONE_SAMPLE)
+	else
 	{
-		VERBOSE_PRINTLN_P("Got data!");
+		uint8_t frame;
 
-		while(true) // Process all requests in the queue.
+		ATOMIC
 		{
-			request = queue.dequeue(); // Dequeue the oldest request.
+			/* Reference the ready frame so the ISR does not switch to it while
+			 * it gets measured. */
+			frame = !acquiring;
+			references[frame]++;
+			frame_read = true;
 
-			if(!request) // If there are no more requests in the queue.
-			{
-				break;
+			measurements.sequence = sequence;
+		}
+
+		data = frames[frame];
+		counter = &references[frame];
+
+		// In 10 bits, frames start on a group of 4 samples.
+		start = resolution == 10 ?
+			frame_starts[frame] / 4 * 5: frame_starts[frame];
+	}
+
+	bool wide = resolution == 10;
+	uint16_t size = frame_size();
+
+	uint16_t low = 0xFFFF, high = 0;
+	uint32_t sum = 0, squares = 0; // 255 squared 10 bits samples fit.
+
+	for(uint8_t i = 0; i < record_length; i++)
+	{
+		uint16_t sample = FrameFile::unpack(data, size, start, i, wide);
+
+		if(sample < low) { low = sample; }
+		if(sample > high) { high = sample; }
+
+		sum += sample;
+		squares += (uint32_t)sample * sample;
+	}
+
+	/* The signal crosses its middle once going up every period. Crossings
+	 * need to get past a hysteresis so noise around the middle does not
+	 * count as crossings. */
+	uint16_t middle = (low + high) / 2;
+	uint16_t hysteresis = (high - low) / 8;
+
+	int8_t state = 0; // 1 above the hysteresis, -1 under, 0 unknown yet.
+	uint8_t crossings = 0; // The number of times the signal went up.
+	uint8_t first = 0, last = 0; // The first and last samples that went up.
+	uint16_t above = 0; // The samples above the middle since the first one.
+	uint16_t above_periods = 0; // The same up to the last one.
+
+	for(uint8_t i = 0; i < record_length; i++)
+	{
+		uint16_t sample = FrameFile::unpack(data, size, start, i, wide);
+
+		if(sample > middle + hysteresis) // If the signal is high.
+		{
+			if(state < 0) // If it just went up, a period starts.
+			{
+				if(!crossings)
+				{
+					first = i;
+				}
+
+				last = i;
+				above_periods = above;
+				crossings++;
+			}
+
+			state = 1;
+		}
+		else if(sample + hysteresis < middle) // If the signal is low.
+		{
+			state = -1;
+		}
+
+		if(crossings && sample > middle)
+		{
+			above++;
+		}
+	}
+
+	(*counter)--; // The frame is not referenced anymore.
+
+	// Samples are converted to millivolts at the resolution of the channel.
+	measurements.min = (uint32_t)low * ADC_REFERENCE >> resolution;
+	measurements.max = (uint32_t)high * ADC_REFERENCE >> resolution;
+	measurements.mean = sum * ADC_REFERENCE / record_length >> resolution;
+
+	// The root is computed with 4 more bits of precision.
+	measurements.rms = (uint32_t)square_root(squares / record_length << 8) *
+		ADC_REFERENCE >> (resolution + 4);
+
+	if(crossings >= 2) // If there is at least one whole period.
+	{
+		// The length of the whole periods, at least 2 samples each.
+		uint8_t span = last - first;
+
+		// The same in conversions of the channel, and their number per second.
+		uint32_t ticks = (uint32_t)span * decimation;
+		uint32_t cycles = (uint32_t)(crossings - 1) * rate;
+
+		// The frequency is divided in two steps so it does not overflow.
+		measurements.frequency = cycles / ticks * 1000 +
+			cycles % ticks * 1000 / ticks;
+
+		// Periods past 4294 s do not fit in microseconds.
+		if(ticks / cycles < 4294)
+		{
+			// The period is divided by steps of 100 so it does not overflow.
+			uint32_t remainder = ticks % cycles;
+
+			measurements.period = ticks / cycles;
+
+			for(uint8_t i = 0; i < 3; i++)
+			{
+				remainder *= 100;
+				measurements.period = measurements.period * 100 +
+					remainder / cycles;
+				remainder %= cycles;
+			}
+		}
+		else
+		{
+			measurements.period = 0;
+		}
+
+		measurements.duty = (uint32_t)above_periods * 1000 / span;
+	}
+	else
+	{
+		measurements.frequency = 0;
+		measurements.period = 0;
+		measurements.duty = 0;
+	}
+
+	measured = true;
+}
+
+File* Channel::get_spectrum(Request* request)
+{
+	char buffer[8]; // A buffer to store the window.
+
+	// Find an argument named wn (window).
+	uint8_t len = request->find_arg("wn", buffer, 7);
+
+	buffer[len] = '\0'; // Terminate the string.
+
+	uint8_t window = WINDOW_NONE;
+
+	if(!strcmp(buffer, "hann"))
+	{
+		window = WINDOW_HANN;
+	}
+	else if(!strcmp(buffer, "flattop"))
+	{
+		window = WINDOW_FLAT_TOP;
+	}
+
+	uint8_t points = SpectrumFile::points(record_length);
+
+	/* The samples are copied out of the frame so it can still be sent and
+	 * acquired in, then transformed in place into the bins. Combined frames
+	 * are copied into the sums when they are free, which are long enough. */
+	int16_t* samples = sums && sums_empty() ? (int16_t*)sums:
+		(int16_t*)ts_malloc(points * sizeof(int16_t));
+
+	if(!samples) // If the samples could not be allocated.
+	{
+		Statistics::allocation_failed();
+
+		return NULL; // Not enough memory to proceed.
+	}
+
+	frame_header_t header;
+
+	header.version = FRAME_HEADER_VERSION;
+	header.channel = number;
+	header.flags = FRAME_SPECTRUM;
+	header.resolution = resolution;
+	header.rate = frame_rate(sampling_rate, decimation_shift);
+	header.trigger = NO_TRIGGER;
+
+	const uint8_t* data;
+	uint16_t start;
+	volatile uint8_t* counter; // The reference count of the frame.
+
+	if(sums) // If frames are combined before being published.
+	{
+		// Reference the average so it does not get replaced while copied.
+		average_references++;
+
+		data = average;
+		start = 0;
+		counter = &average_references;
+
+		header.sequence = average_sequence;
+		header.timestamp = average_time;
+
+		if(interleaved()) // If the frame is a composite.
+		{
+			header.flags |= FRAME_INTERLEAVED;
+			header.rate *= interleave;
+		}
+		else if(sweeps > 1) // If the frame is an average.
+		{
+			header.flags |= FRAME_AVERAGED;
+		}
+
+		ATOMIC { header.dropped = dropped; }
+	}
+	else
+	{
+		uint8_t frame;
+
+		ATOMIC
+		{
+			/* Reference the ready frame so the ISR does not switch to it while
+			 * it gets copied. */
+			frame = !acquiring;
+			references[frame]++;
+			frame_read = true;
+
+			header.sequence = sequence;
+			header.dropped = dropped;
+		}
+
+		data = frames[frame];
+		counter = &references[frame];
+
+		// In 10 bits, frames start on a group of 4 samples.
+		start = resolution == 10 ?
+			frame_starts[frame] / 4 * 5: frame_starts[frame];
+
+		header.timestamp = frame_times[frame];
+	}
+
+	// The samples are centered and take half of the full scale in Q15.
+	for(uint8_t i = 0; i < points; i++)
+	{
+		samples[i] = ((int16_t)FrameFile::unpack(data, frame_size(), start,
+			record_length - points + i, resolution == 10) -
+			(1 << (resolution - 1))) * (1 << (15 - resolution));
+	}
+
+	(*counter)--; // The frame is not referenced anymore.
+
+	SpectrumFile::apply_window(samples, points, window);
+
+	header.record_length = SpectrumFile::transform(samples, points);
+
+	// Only the bins are kept while they are sent, in a block of their size.
+	uint8_t* bins = (uint8_t*)ts_malloc(header.record_length);
+
+	if(bins)
+	{
+		memcpy(bins, samples, header.record_length);
+	}
+
+	if(samples == (int16_t*)sums) // If the samples were in the sums.
+	{
+		// The next frame combined starts from empty sums.
+		memset(sums, 0, record_length * sizeof(uint16_t));
+	}
+	else
+	{
+		ts_free(samples);
+	}
+
+	if(!bins) // If the bins could not be allocated.
+	{
+		Statistics::allocation_failed();
+
+		return NULL; // Not enough memory to proceed.
+	}
+
+	File* f = new PooledSpectrumFile(bins, header.record_length);
+
+	if(!f) // If the file could not be allocated.
+	{
+		ts_free(bins);
+
+		return NULL; // Not enough memory to proceed.
+	}
+
+	// Send the metadata of the spectrum before it.
+	File* h = new PooledFrameHeaderFile(f, header);
+
+	if(!h) // If the file could not be allocated.
+	{
+		delete f; // Releases the bins.
+	}
+
+	return h;
+}
+
+void Channel::send_spectra(void)
+{
+	Request* request;
+
+	while((request = spectrum_queue.peek()))
+	{
+		Response* response;
+
+		/* If the mode changed since the request was queued, the samples are
+		 * no longer evenly spaced. Pairs of peaks would be transformed as
+		 * samples at twice their rate. */
+		if(mode != NORMAL_MODE)
+		{
+			request = spectrum_queue.dequeue();
+			stats.unavailable++;
+
+			response = new Response(SERVICE_UNAVAILABLE_503, request);
+
+			if(!response) // If the response could no be allocated.
+			{
+				delete request; // Get rid of the request.
+				break; // Let the client time out at its end.
+			}
+		}
+		else if(spectrum_ready(request)) // If there is a frame to transform.
+		{
+			request = spectrum_queue.dequeue();
+
+			// Craft a response that will contain the spectrum.
+			response = new Response(OK_200, request);
+
+			if(!response) // If the response could not be allocated.
+			{
+				delete request; // Drop the request and let the client time out.
+				break; // Cannot proceed.
+			}
+
+			File* spectrum = get_spectrum(request);
+
+			if(!spectrum) // If the spectrum could not be computed.
+			{
+				// Not enough memory to compute the spectrum.
+				response->response_code_int = SERVICE_UNAVAILABLE_503;
+				stats.unavailable++;
+			}
+			else
+			{
+				// Set the spectrum as the body.
+				response->set_body(spectrum, MIME::APPLICATION_OCTET_STREAM);
+			}
+		}
+		/* If the frame was dropped when the parameters changed and no other
+		 * was completed in time. */
+		else if(request->age + max_request_age < get_uptime())
+		{
+			request = spectrum_queue.dequeue();
+			stats.timeouts++;
+
+			// Inform the client its request has timed out.
+			response = new Response(REQUEST_TIMEOUT_408, request);
+
+			if(!response) // If the response could no be allocated.
+			{
+				delete request; // Get rid of the request.
+				break; // Let the client time out at its end.
+			}
+		}
+		else
+		{
+			break; // Wait for the next frame.
+		}
+
+		dispatch(response); // Dispatch the response to the client.
+	}
+}
+
+bool Channel::spectrum_ready(Request* request)
+{
+	if(!frame_ready()) // If there is no frame to transform.
+	{
+		return false;
+	}
+
+	// Combined frames wait for the sums to be free, unless it is too late.
+	return !sums || sums_empty() ||
+		request->age + max_request_age <= get_uptime();
+}
+
+Response::status_code Channel::process(Request* request, Response* response)
+{
+	Response::status_code status = handle(request, response);
+
+	if(status == SERVICE_UNAVAILABLE_503) // If the request was turned down.
+	{
+		stats.unavailable++;
+	}
+
+	return status;
+}
+
+Response::status_code Channel::handle(Request* request, Response* response)
+{
+	if(!request->to_destination()) // If the request is at destination.
+	{
+			if(request->is_method(Request::GET)) // If this is a GET request.
+			{
+				/* If there was not enough memory to allocate the frames, the
+				 * channel is not converted or its frames are never completed. */
+				if(!record_length || !enabled || mode == ROLL_MODE)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// If a sample the client has not seen yet is ready.
+				if(is_new(request))
+				{
+					// Retrieve the sample.
+					File* body = get_sample(request, response);
+
+					// If there was not enough memory to allocated the file.
+					if(!body)
+					{
+						// Not enough resources to process the request.
+						return SERVICE_UNAVAILABLE_503;
+					}
+
+					// Set the sample file as the response's body.
+					response->set_body(body, MIME::APPLICATION_OCTET_STREAM);
+
+					VERBOSE_PRINTLN_P("Sample ready");
+
+					return OK_200;
+				}
+				else // If there is no sample ready yet.
+				{
+					// Queue the request to process it at a later time.
+					if(queue.queue(request))
+					{
+						return SERVICE_UNAVAILABLE_503; // Queue is full.
+					}
+
+					// Keep track of the deepest the queue got.
+					if(++stats.queued > stats.queued_max)
+					{
+						stats.queued_max = stats.queued;
+					}
+
+					VERBOSE_PRINTLN_P("Sample not ready ");
+
+					schedule_wakeup(); // Run the resource once a frame is ready.
+
+					return RESPONSE_DELAYED_102;
+				}
+			}
+
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+
+	}
+	/* If the request is one resource before destionation, it might refer to
+	 * sub resources of the channel. */
+	else if(request->to_destination() == 1)
+	{
+		request->next(); // Go to the next resource.
+
+		// If the request is for the stream resource.
+		if(!strcmp(request->current(), "stream"))
+		{
+			if(request->is_method(Request::GET)) // If this is a GET request.
+			{
+				/* If there was not enough memory to allocate the frames, the
+				 * channel is not converted or its frames are never completed. */
+				if(!record_length || !enabled || mode == ROLL_MODE)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// A file that sends frames as they get completed.
+				File* body = new StreamFile(this);
+
+				// If there was not enough memory to allocate the file.
+				if(!body)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// Set the stream as the response's body.
+				response->set_body(body, MIME::APPLICATION_OCTET_STREAM);
+
+				// Each frame is sent as a chunk, the body has no Content-Length.
+				response->add_header("Transfer-Encoding", "chunked");
+
+				return OK_200;
+			}
+
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+		}
+		// If the request is for the roll mode history.
+		else if(!strcmp(request->current(), "roll"))
+		{
+			if(request->is_method(Request::GET)) // If this is a GET request.
+			{
+				/* If there was not enough memory to allocate the frames or
+				 * the channel is not converted or rolling. */
+				if(!record_length || !enabled || mode != ROLL_MODE)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				char buffer[6]; // A buffer to store the index.
+
+				// Find an argument named from (the index the client is at).
+				uint8_t len = request->find_arg("from", buffer, 5);
+
+				buffer[len] = '\0'; // Terminate the string.
+
+				// Get the samples the client does not have.
+				File* body = get_roll(strtoul(buffer, NULL, 10), !len);
+
+				// If there was not enough memory to allocate the file.
+				if(!body)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// Set the samples as the response's body.
+				response->set_body(body, MIME::APPLICATION_OCTET_STREAM);
+
+				return OK_200;
+			}
+
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+		}
+		// If the request is for the measurements resource.
+		else if(!strcmp(request->current(), "ms"))
+		{
+			if(request->is_method(Request::GET)) // If this is a GET request.
+			{
+				/* If there was not enough memory to allocate the frames, the
+				 * channel is not converted or there is no frame to measure. */
+				if(!record_length || !enabled || mode == ROLL_MODE ||
+					!frame_ready())
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				File* body = get_measurements(); // Measure the frame.
+
+				// If there was not enough memory to allocate the file.
+				if(!body)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// Set the measurements as the response's body.
+				response->set_body(body, MIME::APPLICATION_JSON);
+
+				return OK_200;
+			}
+
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+		}
+		// If the request is for the spectrum resource.
+		else if(!strcmp(request->current(), "fft"))
+		{
+			if(request->is_method(Request::GET)) // If this is a GET request.
+			{
+				/* If there was not enough memory to allocate the frames, the
+				 * channel is not converted, there is no frame or its samples
+				 * are not evenly spaced. */
+				if(!record_length || !enabled || mode != NORMAL_MODE ||
+					!frame_ready())
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// The transform takes too long to be done while processing.
+				if(spectrum_queue.queue(request))
+				{
+					return SERVICE_UNAVAILABLE_503; // Queue is full.
+				}
+
+				schedule_wakeup(); // Run the resource to compute it.
+
+				return RESPONSE_DELAYED_102;
+			}
+
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+		}
+		// If the request is for the segments resource.
+		else if(!strcmp(request->current(), "seg"))
+		{
+			if(request->is_method(Request::GET)) // If this is a GET request.
+			{
+				File* f = new PooledPGMSpaceFile(segments_P, SEGMENTS_SIZE);
+
+				// If there was no memory left for the file.
+				if(!f)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				Template* t = new PooledTemplate(f); // Create a template.
+
+				// If there was no memory left for the template.
+				if(!t)
+				{
+					delete f; // Delete the file.
+
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				t->add_narg(segment_count);
+				t->add_narg(segments_filled);
+
+				// Set the state of the segments as the response's body.
+				response->set_body(t, MIME::APPLICATION_JSON);
+
+				return OK_200;
+			}
+
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+		}
+		// If the request is for the parameters resource.
+		else if(!strcmp(request->current(), "pr"))
+		{
+			if(request->is_method(Request::POST)) // If it is a POST request.
+			{
+				char buffer[8]; // A buffer to store form data.
+
+				// Find an argument named en (enabled).
+				uint8_t len = request->find_arg("en", buffer, 7);
+
+				if(len) // If there is an argument for the channel being enabled.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					bool en = atoi(buffer); // Convert it to a boolean.
+
+					if(en != enabled) // If the channel is enabled or disabled.
+					{
+						enabled = en;
+
+						ATOMIC
+						{
+
+							// A disabled channel cannot trigger for the others.
+							if(!enabled && leader == this)
+							{
+								leader = NULL;
+							}
+
+							scan_channels(); // Only convert the enabled channels.
+
+							/* The conversions are shared by another number of
+							 * channels, which may not be able to keep the rate. */
+							sampling_rate = set_sampling_rate(sampling_rate);
+
+							for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+							{
+								// Frames acquired in another scan are not valid.
+								instances[i]->trigger_flags &= ~DONE_SAMPLE;
+								instances[i]->select_kernel(); // Restart.
+							}
+						}
+					}
+				}
+
+				// Find an argument named sr (sampling rate).
+				len = request->find_arg("sr", buffer, 7);
+
+				if(len) // If there is an argument for the sampling rate.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					uint32_t rate = strtoul(buffer, NULL, 10);
+
+					/* Clamp the rate before it is narrowed, so rates past 16
+					 * bits do not wrap to a slow one. */
+					if(rate > MAX_SAMPLING_RATE)
+					{
+						rate = MAX_SAMPLING_RATE;
+					}
+
+					/* Configure the hardware, keeping the rate that was
+					 * actually achieved. */
+					sampling_rate = set_sampling_rate(rate);
+				}
+
+				// Find an argument named rl (record length).
+				len = request->find_arg("rl", buffer, 7);
+
+				uint8_t rl = record_length;
+
+				if(len) // If there is an argument for the record length.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					uint16_t value = atoi(buffer); // Convert it to an integer.
+
+					rl = value > 255 ? 255: value;
+				}
+
+				// Find an argument named rs (resolution).
+				uint8_t rs_len = request->find_arg("rs", buffer, 7);
+
+				uint8_t rs = resolution;
+
+				if(rs_len) // If there is an argument for the resolution.
+				{
+					buffer[rs_len] = '\0'; // Terminate the string.
+
+					// Only 8 and 10 bits are supported.
+					rs = atoi(buffer) == 10 ? 10: 8;
+				}
+
+				// If the format of the frames is changed.
+				if(len || rs_len)
+				{
+					// Reallocate the frames to the longest length that fits.
+					configure_frames(rl, rs);
+				}
+
+				// Find an argument named am (acquisition mode).
+				len = request->find_arg("am", buffer, 7);
+
+				if(len) // If there is an argument for the acquisition mode.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+
+					uint8_t am = atoi(buffer); // Convert it to an integer.
+
+					ATOMIC
+					{
+						mode = am == PEAK_DETECT_MODE || am == ROLL_MODE ?
+							am: NORMAL_MODE;
+
+						// Frames acquired in another mode are no longer valid.
+						trigger_flags &= ~DONE_SAMPLE;
+						restart(); // Restart acquisition.
+					}
+				}
+
+				// Find an argument named dc (decimation).
+				len = request->find_arg("dc", buffer, 7);
+
+				if(len) // If there is an argument for the decimation.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					uint16_t dc = atoi(buffer); // Convert it to an integer.
+
+					ATOMIC
+					{
+						// Round the factor down to a power of two.
+						for(decimation_shift = 0, decimation = 1;
+							decimation < max_decimation && decimation * 2 <= dc;
+							decimation_shift++, decimation *= 2);
+
+						// Frames acquired at another rate are no longer valid.
+						trigger_flags &= ~DONE_SAMPLE;
+						restart(); // Restart acquisition.
+					}
+				}
+
+				// Find an argument named tl (trigger level).
+				len = request->find_arg("tl", buffer, 7);
+
+				if(len) // If there is an argument for the trigger level.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					// Convert it to an integer and set it.
+					ATOMIC
+					{
+						trigger_level = atoi(buffer);
+						// Samples are compared to the trigger level in 10 bits.
+						trigger_threshold = resolution == 10 ?
+							trigger_level: trigger_level << 2;
+					}
+				}
+
+				// Find an argument named pt (pre-trigger).
+				len = request->find_arg("pt", buffer, 7);
+
+				if(len) // If there is an argument for the pre-trigger.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					uint16_t pt = atoi(buffer); // Convert it to an integer.
+
+					ATOMIC
+					{
+						trigger_position = pt > 100 ? 100: pt;
+						restart(); // Restart acquisition.
+					}
+				}
+
+				// Find an argument named tf (trigger flags).
+				len = request->find_arg("tf", buffer, 7);
+
+				if(len) // If there is an argument for the trigger flags.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					// Convert it to an integer and set it.
+					ATOMIC
+					{
+						// Only the configuration flags can be set.
+						trigger_flags = atoi(buffer) & (TRIGGER_ON | TRIGGER_SLOPE_UP);
+						restart(); // Acquire with the new configuration.
+					}
+				}
+
+				// Find an argument named av (averaging).
+				len = request->find_arg("av", buffer, 7);
+
+				uint8_t av = sweeps;
+
+				if(len) // If there is an argument for the averaging.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					uint16_t value = atoi(buffer); // Convert it to an integer.
+
+					av = value > max_sweeps ? max_sweeps: value;
+				}
+
+				// Find an argument named et (equivalent-time).
+				uint8_t et_len = request->find_arg("et", buffer, 7);
+
+				uint8_t et = interleave;
+
+				if(et_len) // If there is an argument for the interleaving.
+				{
+					buffer[et_len] = '\0'; // Terminate the string.
+					uint16_t value = atoi(buffer); // Convert it to an integer.
+
+					et = value > max_interleave ? max_interleave: value;
+				}
+
+				// If the way frames are combined is changed.
+				if(len || et_len)
+				{
+					// Allocate the buffers for combining them.
+					configure_sweeps(av, et);
+				}
+				else
+				{
+					// Frames acquired with other parameters are not averaged.
+					restart_sweeps();
+				}
+
+				schedule_wakeup(); // Start or stop combining frames.
+
+				// Find an argument named sg (segments).
+				len = request->find_arg("sg", buffer, 7);
+
+				if(len) // If there is an argument for the segments.
+				{
+					buffer[len] = '\0'; // Terminate the string.
+					uint16_t value = atoi(buffer); // Convert it to an integer.
+
+					// Empty the segments, reallocating them if needed.
+					configure_segments(value > max_segments ?
+						max_segments: value);
+				}
+
+				goto get; // Proceed the rest of the request like a GET.
+			}
+			// If this ia GET request.
+			else if(request->is_method(Request::GET))
+			{
+				get:
+
+				File* body = get_params(); // Get the parameters for this channel.
+
+				/* If there was not enough memory to allocate a file to hold
+				 * the parameters JSON array. */
+				if(!body)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// Set the parameters file as the response body.
+				response->set_body(body, MIME::APPLICATION_JSON);
+
+				return OK_200;
+			}
+
+			return NOT_IMPLEMENTED_501; // Request method not implemented.
+		}
+
+		/* This url cannot be processed, pass it to child resources. Because
+		 * we jumped to the next resource earlier, the request url needs to be
+		 * rewinded.*/
+		request->previous();
+	}
+	/* If the request is two resources before destination, it might refer to
+	 * a segment. */
+	else if(request->to_destination() == 2)
+	{
+		request->next(); // Go to the next resource.
+
+		// If the request is for a segment.
+		if(!strcmp(request->current(), "seg"))
+		{
+			request->next(); // Go to the index of the segment.
+
+			char* end;
+			uint16_t index = strtoul(request->current(), &end, 10);
+
+			// If the index is a number of a segment that was filled.
+			if(*request->current() && !*end && index < segments_filled)
+			{
+				if(!request->is_method(Request::GET))
+				{
+					return NOT_IMPLEMENTED_501; // Request method not implemented.
+				}
+
+				File* body = get_segment(index); // Get the segment.
+
+				// If there was not enough memory to allocate the file.
+				if(!body)
+				{
+					// Not enough resources to process the request.
+					return SERVICE_UNAVAILABLE_503;
+				}
+
+				// Set the segment as the response's body.
+				response->set_body(body, MIME::APPLICATION_OCTET_STREAM);
+
+				return OK_200;
+			}
+
+			request->previous(); // Rewind the index.
+		}
+
+		request->previous(); // Rewind the url to pass it to child resources.
+	}
+
+	return PASS_308; // Cannot process this request.
+}
+
+File* Channel::get_sample(Request* request, Response* response)
+{
+	char buffer[8]; // A buffer to store the encoding.
+
+	// Find an argument named ec (encoding).
+	uint8_t len = request->find_arg("ec", buffer, 5);
+
+	buffer[len] = '\0'; // Terminate the string.
+
+	// If the client asked for a compressed frame.
+	FrameHeaderFile* f = get_frame(!strcmp(buffer, "delta"));
+
+	if(f) // If the frame could be retrieved.
+	{
+		// The tag lives in the file, which is deleted with the response.
+		response->add_header("ETag", f->entity_tag());
+	}
+
+	return f;
+}
+
+bool Channel::is_new(Request* request)
+{
+	if(!frame_ready()) // If there is no frame at all.
+	{
+		return false;
+	}
+
+	char buffer[6]; // A buffer to store the sequence number.
+
+	// Find an argument named since (sequence number).
+	uint8_t len = request->find_arg("since", buffer, 5);
+
+	if(!len) // If the client takes any frame.
+	{
+		return true;
+	}
+
+	buffer[len] = '\0'; // Terminate the string.
+
+	// If the frame is not the one the client already has.
+	return (uint16_t)strtoul(buffer, NULL, 10) != frame_sequence();
+}
+
+FrameHeaderFile* Channel::get_frame(bool compressed)
+{
+	frame_header_t header;
+
+	header.version = FRAME_HEADER_VERSION;
+	header.channel = number;
+	header.flags = compressed ? FRAME_COMPRESSED: 0;
+	header.resolution = resolution;
+	header.rate = frame_rate(sampling_rate, decimation_shift);
+	header.record_length = record_length;
+
+	if(mode == PEAK_DETECT_MODE) // If the frame holds pairs of peaks.
+	{
+		header.flags |= FRAME_PEAKS;
+	}
+
+	const uint8_t* data;
+	uint16_t start;
+	volatile uint8_t* counter; // The reference count of the frame.
+
+	if(sums) // If frames are combined before being published.
+	{
+		/* Reference the average so it does not get replaced until the file
+		 * is deleted. Only run() replaces it, so this does not need to be
+		 * atomic. */
+		average_references++;
+
+		data = average;
+		start = 0;
+		counter = &average_references;
+
+		header.sequence = average_sequence;
+		header.timestamp = average_time;
+
+		// Triggered frames are combined with the trigger where requested.
+		header.trigger = trigger_flags & TRIGGER_ON ? pre_trigger: NO_TRIGGER;
+
+		if(interleaved()) // If the frame is a composite.
+		{
+			header.flags |= FRAME_INTERLEAVED;
+			header.rate *= interleave;
+		}
+		else if(sweeps > 1) // If the frame is an average.
+		{
+			header.flags |= FRAME_AVERAGED;
+		}
+
+		ATOMIC { header.dropped = dropped; }
+	}
+	else
+	{
+		uint8_t frame;
+
+		ATOMIC
+		{
+			/* Reference the ready frame so the ISR does not switch to it until
+			 * the file is deleted. */
+			frame = !acquiring;
+			references[frame]++;
+			frame_read = true;
+
+			// The metadata changes along with the ready frame.
+			header.sequence = sequence;
+			header.dropped = dropped;
+		}
+
+		data = frames[frame];
+		counter = &references[frame];
+
+		// In 10 bits, frames start on a group of 4 samples.
+		start = resolution == 10 ?
+			frame_starts[frame] / 4 * 5: frame_starts[frame];
+
+		header.timestamp = frame_times[frame];
+		header.trigger = trigger_index(frame);
+	}
+
+	FrameFile* f;
+
+	/* Wrap the frame into a file, the frame is not copied but rotated so the
+	 * trigger sits at the requested position. */
+	if(compressed) // If the frame should be compressed.
+	{
+		// The frame is encoded as it gets read.
+		f = new PooledDeltaFrameFile(data, frame_size(), start, counter,
+			resolution == 10);
+	}
+	else
+	{
+		f = new PooledFrameFile(data, frame_size(), start, counter);
+	}
+
+	if(!f) // If the file could not be allocated.
+	{
+		(*counter)--; // The frame is not referenced.
+
+		return NULL; // Not enough memory to proceed.
+	}
+
+	// Send the metadata of the frame before it.
+	FrameHeaderFile* h = new PooledFrameHeaderFile(f, header);
+
+	if(!h) // If the file could not be allocated.
+	{
+		delete f; // Releases the frame.
+	}
+
+	return h;
+}
+
+uint8_t Channel::trigger_index(uint8_t frame)
+{
+	if(trigger_ptrs[frame] == NO_TRIGGER) // If the frame was not triggered.
+	{
+		return NO_TRIGGER;
+	}
+
+	// The index of the sample that triggered from the oldest one.
+	int16_t trigger = (int16_t)trigger_ptrs[frame] - 1 - frame_starts[frame];
+
+	if(trigger < 0) // If the frame has wrapped around at that position.
+	{
+		trigger += record_length;
+	}
+
+	return trigger;
+}
+
+void Channel::run(void)
+{
+	Request* request = NULL;
+
+	VERBOSE_PRINTLN_P("Channel run ");
+
+	Statistics::sample_heap(); // The heap is the fullest while frames are sent.
+
+	if(sums) // If frames are combined before being published.
+	{
+		combine_frame(); // Combine the frame that was just acquired.
+	}
+
+	send_spectra(); // Only done when requests are waiting for a spectrum.
+
+	/* Remove the requests that have time out from the queue an get to the
+	 * request to which the sample needs to be sent. Requests are queued in
+	 * the order they arrived, so the ones that time out first are at the
+	 * head of the queue.*/
+	while(true)
+	{
+		///TODO move the next line into the loop condition.
+
+		request = queue.peek(); // Is there a request waiting for a sample?
+
+		if(!request) // If there is no waiting request.
+		{
+			break; // Nothing else to do.
+		}
+
+		// If the request has timed out.
+		if(request->age + max_request_age < get_uptime())
+		{
+			VERBOSE_PRINTLN_P("Request too old");
+
+			request = queue.dequeue(); // Remove the request from the queue.
+			stats.queued--;
+
+			char buffer[6]; // A buffer to store the sequence number.
+
+			/* Craft a response to inform the client his request has timed out,
+			 * if it was waiting for a newer frame, the one it has is still the
+			 * current one. */
+			Response::status_code status = request->find_arg("since", buffer, 5) ?
+				NOT_MODIFIED_304: REQUEST_TIMEOUT_408;
+
+			if(status == REQUEST_TIMEOUT_408)
+			{
+				stats.timeouts++;
+			}
+
+			Response* response = new Response(status, request);
+			if(!response) // If the response could no be allocated.
+			{
+				delete request; // Get rid of the request.
+
+				// Nothing more we can do, let the client time out at its end.
+				schedule_wakeup();
+
+				return;
 			}
+
+			dispatch(response); // Dispatch the response to the client.
+		}
+		else // Process that request.
+		{
+			VERBOSE_PRINTLN_P("No Request too old");
+			break; // Keep the current requests in the queue.
+		}
+	}
+	// If there is a request waiting for a sample and one is ready.
+	if(request && is_new(request))
+	{
+		VERBOSE_PRINTLN_P("Got data!");
+
+		/* Process the requests in the queue. Since sequence numbers only go
+		 * up, the ones waiting for a frame newer than the current one are
+		 * at the end of the queue. */
+		while((request = queue.peek()) && is_new(request))
+		{
+			request = queue.dequeue(); // Dequeue the oldest request.
+			stats.queued--;
+
 			// Craft a response that will contain the sample.
 			Response* response = new Response(OK_200, request);
 
-			if(!response) // If the response could not be allocated.
-			{
-				delete request; // Drop the request and let the client time out.
-				break; // Cannot proceed.
+			if(!response) // If the response could not be allocated.
+			{
+				delete request; // Drop the request and let the client time out.
+				break; // Cannot proceed.
+
+				/* Do not empty the queue, maybe there will be resources available
+				 * during the next run to process the next request. */
+			}
+
+			// Get the current sample.
+			File* sample = get_sample(request, response);
+			if(!sample) // If the sample file could no be allocated.
+			{
+				// Not enough memory to get the sample.
+				response->response_code_int = SERVICE_UNAVAILABLE_503;
+				stats.unavailable++;
+			}
+			else
+			{
+				// Set the sample as the body.
+				response->set_body(sample, MIME::APPLICATION_OCTET_STREAM);
+			}
+
+			dispatch(response); // Dispatch the response to the client.
+		}
+	}
+
+	// Sleep until a frame is ready or the oldest request times out.
+	schedule_wakeup();
+}
+
+void Channel::schedule_wakeup(void)
+{
+	Request* request = queue.peek(); // The request that times out first.
+	Request* spectrum = spectrum_queue.peek();
+
+	// If the request for a spectrum times out first.
+	if(!request || (spectrum && spectrum->age < request->age))
+	{
+		request = spectrum;
+	}
+
+	/* The ISR may schedule this resource as well, so interrupts are disabled
+	 * to keep it from doing so while it is being scheduled here. */
+	ATOMIC
+	{
+		// The ISR wakes the resource up when a frame is completed.
+		wake_on_frame = request || sums;
+
+		// If a frame was completed and not yet combined.
+		if(sums && trigger_flags & DONE_SAMPLE && sequence != summed_sequence)
+		{
+			schedule(0); // It was completed before the ISR could wake it up.
+		}
+		// If a spectrum can be computed.
+		else if(spectrum && spectrum_ready(spectrum))
+		{
+			schedule(0);
+		}
+		// If a frame is ready but the requests could not be answered.
+		else if(request && request != spectrum && is_new(request))
+		{
+			schedule(1); // Maybe memory will be available in 1 ms.
+		}
+		else if(request) // If a request is waiting for a frame.
+		{
+			uptime_t deadline = request->age + max_request_age;
+			uptime_t now = get_uptime();
+
+			// Run the resource when it times out.
+			schedule(deadline >= now ? deadline - now + 1: 1);
+		}
+		else
+		{
+			schedule(NEVER); // Nothing to do until a frame is needed.
+		}
+	}
+}
+
+void Channel::configure_frames(uint8_t length, uint8_t bits)
+{
+	// If a frame, the average or a segment is being sent.
+	if(references[0] || references[1] || average_references ||
+		segment_references)
+	{
+		return; // It cannot be reallocated, keep the current format.
+	}
+
+	uint8_t count = segment_count;
+
+	// The segments must be as long as the frames, free them first as well.
+	configure_segments(0);
+
+	resolution = bits;
+
+	ATOMIC
+	{
+		kernel = &Channel::idle; // Stop storing samples in the frames.
+		trigger_flags &= ~DONE_SAMPLE; // The frame that was ready is lost.
+	}
+
+	// Free the frames before allocating them again to reduce fragmentation.
+	free_frames();
+
+	if(length < min_record_length) // If the frames would be too short.
+	{
+		length = min_record_length;
+	}
+
+	while(true)
+	{
+		if(resolution == 10) // If samples are packed in groups of 4.
+		{
+			length &= ~3; // Only keep complete groups.
+		}
+		else
+		{
+			length &= ~1; // Only keep complete pairs of peaks.
+		}
+
+		record_length = length;
+
+		if(allocate_frames()) // If both frames could be allocated.
+		{
+			Statistics::sample_heap();
+
+			break;
+		}
+
+		Statistics::allocation_failed();
+
+		free_frames(); // Give back the memory that was allocated.
+
+		if(length == min_record_length) // If the frames cannot get shorter.
+		{
+			length = 0; // The channel will not be able to acquire.
+			break;
+		}
+
+		length /= 2; // Try with frames half as long.
+
+		if(length < min_record_length)
+		{
+			length = min_record_length;
+		}
+	}
+
+	ATOMIC
+	{
+		record_length = length;
+		restart(); // Restart acquisition in the new frames.
+	}
+
+	// The average must be as long as the frames.
+	configure_sweeps(sweeps, interleave);
+
+	configure_segments(count);
+}
+
+bool Channel::allocate_frames(void)
+{
+	uint16_t reserved = 0; // The memory reserved already used.
+
+	for(uint8_t i = 0; i < 2; i++)
+	{
+		// Use the memory reserved if the frame fits in what is left of it.
+		if(reserved + frame_size() <= FRAME_POOL_SIZE)
+		{
+			buffers[i] = frame_pool + reserved;
+			reserved += frame_size();
+		}
+		else
+		{
+			buffers[i] = (uint8_t*)ts_malloc(frame_size());
+		}
+
+		frames[i] = buffers[i];
+	}
+
+	return frames[0] && frames[1];
+}
+
+void Channel::free_frames(void)
+{
+	for(uint8_t i = 0; i < 2; i++)
+	{
+		// If it is on the heap.
+		if(buffers[i] && (buffers[i] < frame_pool ||
+			buffers[i] >= frame_pool + FRAME_POOL_SIZE))
+		{
+			ts_free(buffers[i]);
+		}
+
+		frames[i] = buffers[i] = NULL;
+	}
+}
+
+uint16_t Channel::frame_size(void)
+{
+	// In 10 bits, every 4 samples take 5 bytes.
+	return resolution == 10 ? record_length / 4 * 5: record_length;
+}
+
+void Channel::configure_sweeps(uint8_t count, uint8_t factor)
+{
+	if(average_references) // If the average is being sent.
+	{
+		return; // It cannot be reallocated, keep averaging the same way.
+	}
+
+	average_ready = false; // The average that was ready is lost.
+
+	// Free the buffers before allocating them again to reduce fragmentation.
+	if(sums) { ts_free(sums); }
+	if(average) { ts_free(average); }
+
+	sums = NULL;
+	average = NULL;
+
+	// Round the number of frames down to a power of two.
+	for(sweeps_shift = 0, sweeps = 1;
+		sweeps < max_sweeps && sweeps * 2 <= count;
+		sweeps_shift++, sweeps *= 2);
+
+	// Round the interleaving factor down to a power of two.
+	for(interleave = 1;
+		interleave < max_interleave && interleave * 2 <= factor;
+		interleave *= 2);
+
+	// If frames are averaged or interleaved.
+	if(sweeps > 1 || interleave > 1)
+	{
+		if(record_length) // If there are frames to combine.
+		{
+			sums = (uint16_t*)ts_malloc(record_length * sizeof(uint16_t));
+			average = (uint8_t*)ts_malloc(frame_size());
+		}
+
+		if(!sums || !average) // If the buffers could not be allocated.
+		{
+			Statistics::allocation_failed();
+
+			// Give back the memory that was allocated.
+			if(sums) { ts_free(sums); }
+			if(average) { ts_free(average); }
+
+			sums = NULL;
+			average = NULL;
+
+			// Frames will be published as they are acquired.
+			sweeps = 1;
+			sweeps_shift = 0;
+			interleave = 1;
+		}
+	}
+
+	restart_sweeps();
+}
+
+void Channel::restart_sweeps(void)
+{
+	if(sums) // If frames are averaged.
+	{
+		memset(sums, 0, record_length * sizeof(uint16_t));
+	}
+
+	sweeps_left = sweeps;
+	interleaved_bins = 0;
+	measured = false; // The average is of frames with other parameters.
+
+	// The frame that is ready could have been acquired with other parameters.
+	ATOMIC { summed_sequence = sequence; }
+}
+
+void Channel::configure_segments(uint8_t count)
+{
+	bool referenced = segment_references;
+
+	ATOMIC
+	{
+		for(uint8_t i = 0; i < 2; i++)
+		{
+			// If a frame acquired in a segment is being sent.
+			if(references[i] && frames[i] != buffers[i])
+			{
+				referenced = true;
+			}
+		}
+	}
+
+	if(referenced) // If a segment is being sent.
+	{
+		return; // They cannot be emptied or reallocated.
+	}
+
+	ATOMIC
+	{
+		segments_filled = 0; // Fill them again from the first one.
+
+		for(uint8_t i = 0; i < 2; i++)
+		{
+			if(frames[i] == buffers[i]) // If the frame is in its own memory.
+			{
+				continue;
+			}
+
+			frames[i] = buffers[i]; // Stop using the segment.
+
+			if(i == acquiring) // If it was being acquired in the segment.
+			{
+				restart(); // Restart acquisition in the frame's own memory.
+			}
+			else
+			{
+				// The frame that was ready is lost.
+				trigger_flags &= ~DONE_SAMPLE;
+			}
+		}
+	}
+
+	if(count == segment_count) // If there are as many segments.
+	{
+		return; // They are only emptied.
+	}
+
+	uint8_t* memory = segments;
+
+	ATOMIC
+	{
+		segments = NULL; // Stop acquiring frames in the segments.
+		segment_info = NULL;
+		segment_count = 0;
+	}
+
+	if(memory) { ts_free(memory); }
+
+	if(count < 1 || !record_length) // If no segments are kept.
+	{
+		return;
+	}
+
+	// The metadata of the segments is kept after them.
+	memory = (uint8_t*)ts_malloc(count * (frame_size() + sizeof(segment_t)));
+
+	if(!memory) // If the segments could not be allocated.
+	{
+		Statistics::allocation_failed();
+
+		return; // No segments are kept.
+	}
+
+	Statistics::sample_heap();
+
+	ATOMIC
+	{
+		segment_info = (segment_t*)(memory + count * frame_size());
+		segment_count = count;
+		segments = memory; // Acquire the next frames in the segments.
+	}
+}
+
+void Channel::store_segment(uint8_t frame)
+{
+	uint16_t size = frame_size();
+	uint8_t* segment = segments + segments_filled * size;
+
+	// If the frame was acquired in the next segment.
+	if(frames[frame] == segment)
+	{
+		segment_t* info = segment_info + segments_filled;
+
+		// If the frame was just frozen, it already has its timestamp.
+		info->time = frame == acquiring ? get_uptime(): frame_times[frame];
+		info->rate = sampling_rate;
+		info->decimation_shift = decimation_shift;
+		info->start = frame_starts[frame];
+		info->trigger = trigger_index(frame);
+		info->flags = mode == PEAK_DETECT_MODE ? FRAME_PEAKS: 0;
+
+		segments_filled++; // Keep it there.
+		segment += size;
+	}
+
+	/* Acquire in the following segment, or in the frame's own memory once
+	 * they are all filled. */
+	frames[acquiring] = segments_filled < segment_count ? segment:
+		buffers[acquiring];
+}
+
+void Channel::combine_frame(void)
+{
+	uint8_t frame;
+	bool ready;
+
+	ATOMIC
+	{
+		// If a frame was completed since the last one was combined.
+		ready = trigger_flags & DONE_SAMPLE && sequence != summed_sequence;
+
+		summed_sequence = sequence;
+
+		/* Reference the ready frame so the ISR does not switch to it while
+		 * it gets combined. */
+		frame = !acquiring;
+		references[frame]++;
+		frame_read = true;
+	}
+
+	if(!ready) // If the frame was already combined.
+	{
+		references[frame]--; // The ISR only reads the count.
+
+		return;
+	}
+
+	// In 10 bits, frames start on a group of 4 samples.
+	uint16_t start = resolution == 10 ?
+		frame_starts[frame] / 4 * 5: frame_starts[frame];
+
+	// If the frame is binned into the composite frame.
+	if(interleaved() && trigger_ptrs[frame] != NO_TRIGGER)
+	{
+		// The distance to the trigger level of the samples around it.
+		uint16_t span, overshoot;
+
+		if(trigger_samples[frame][1] >= trigger_samples[frame][0])
+		{
+			span = trigger_samples[frame][1] - trigger_samples[frame][0];
+		}
+		else
+		{
+			span = trigger_samples[frame][0] - trigger_samples[frame][1];
+		}
+
+		if(trigger_samples[frame][1] >= trigger_threshold)
+		{
+			overshoot = trigger_samples[frame][1] - trigger_threshold;
+		}
+		else
+		{
+			overshoot = trigger_threshold - trigger_samples[frame][1];
+		}
+
+		/* The fraction of a sample period by which the signal crossed the
+		 * trigger level before the sample that triggered, in 1 / interleave
+		 * units. It is interpolated on a straight line between the samples. */
+		uint8_t bin = 0;
+
+		if(span) // If the samples are not equal.
+		{
+			uint16_t fraction = (uint32_t)overshoot * interleave / span;
+
+			bin = fraction >= interleave ? interleave - 1: fraction;
+		}
+
+		// The index of the sample that triggered from the oldest one.
+		int16_t trigger = trigger_index(frame);
+
+		/* Place the samples in the composite frame so the trigger sits at the
+		 * requested position, each sample period taking interleave slots. */
+		int16_t slot = (int16_t)pre_trigger + bin - trigger * interleave;
+
+		for(uint8_t i = 0; i < record_length; i++, slot += interleave)
+		{
+			if(slot >= record_length) // If the composite frame is full.
+			{
+				break;
+			}
+
+			if(slot >= 0) // If the sample falls in the composite frame.
+			{
+				sums[slot] = FrameFile::unpack(frames[frame], frame_size(),
+					start, i, resolution == 10);
+			}
+		}
+
+		references[frame]--; // The ISR only reads the count.
+
+		interleaved_bins |= _BV(bin);
+
+		// If every phase has been acquired.
+		if(interleaved_bins == (uint8_t)((1 << interleave) - 1))
+		{
+			publish(0); // Publish the composite frame.
+			interleaved_bins = 0;
+		}
+
+		return;
+	}
+
+	for(uint8_t i = 0; i < record_length; i++)
+	{
+		sums[i] += FrameFile::unpack(frames[frame], frame_size(), start, i,
+			resolution == 10);
+	}
+
+	references[frame]--; // The ISR only reads the count.
+
+	if(--sweeps_left) // If more frames need to be added before averaging.
+	{
+		return;
+	}
+
+	publish(sweeps_shift); // Publish the average.
 
-				/* Do not empty the queue, maybe there will be resources available
-				 * during the next run to process the next request. */
-			}
+	memset(sums, 0, record_length * sizeof(uint16_t));
+	sweeps_left = sweeps;
+}
 
-			File* sample = get_sample(); // Get the current sample.
-			if(!sample) // If the sample file could no be allocated.
+void Channel::publish(uint8_t shift)
+{
+	if(average_references) // If the last frame published is still being sent.
+	{
+		/* This one is dropped, the same way frames are dropped when the
+		 * ready one is still being sent. */
+		return;
+	}
+
+	// Divide the sums, samples get packed the same way as in the frames.
+	for(uint8_t i = 0; i < record_length; i++)
+	{
+		uint16_t sample = sums[i] >> shift;
+
+		if(resolution == 10) // If samples are packed in groups of 4.
+		{
+			uint8_t* group = average + i / 4 * 5;
+			uint8_t slot = i & 3; // The position of the sample in the group.
+
+			group[slot] = sample >> 2; // Save the 8 most significant bits.
+
+			// Save the 2 least significant bits in the last byte of the group.
+			group[4] = (slot ? group[4]: 0) | (sample & 3) << (slot * 2);
+		}
+		else
+		{
+			average[i] = sample;
+		}
+	}
+
+	average_ready = true;
+	average_sequence++; // This is a new frame.
+	average_time = get_uptime();
+}
+
+bool Channel::interleaved(void)
+{
+	/* The phase of the signal can only be known from a trigger and pairs of
+	 * peaks cannot be interleaved. */
+	return interleave > 1 && trigger_flags & TRIGGER_ON &&
+		mode == NORMAL_MODE;
+}
+
+bool Channel::sums_empty(void)
+{
+	// Composite frames are published once every phase was acquired.
+	return interleaved() ? !interleaved_bins: sweeps_left == sweeps;
+}
+
+bool Channel::frame_ready(void)
+{
+	if(sums) // If frames are combined before being published.
+	{
+		return average_ready;
+	}
+
+	return trigger_flags & DONE_SAMPLE;
+}
+
+uint16_t Channel::frame_sequence(void)
+{
+	if(sums) // If frames are combined before being published.
+	{
+		return average_sequence;
+	}
+
+	uint16_t current;
+
+	ATOMIC { current = sequence; }
+
+	return current;
+}
+
+void Channel::select_kernel(void)
+{
+	if(!record_length) // If there are no frames to store samples in.
+	{
+		kernel = &Channel::idle;
+
+		return;
+	}
+
+	if(mode == PEAK_DETECT_MODE) // If the peaks of the samples are kept.
+	{
+		// The ISR finds the peaks before they get passed to the kernel.
+		kernel = &Channel::detect_peaks;
+		kernel_slot = &decimated_kernel;
+		minimum = 0xFFFF;
+		maximum = 0;
+		decimation_left = decimation;
+	}
+	else if(decimation > 1) // If samples are decimated.
+	{
+		// The ISR averages samples before they get passed to the kernel.
+		kernel = &Channel::decimate;
+		kernel_slot = &decimated_kernel;
+		accumulator = 0;
+		decimation_left = decimation;
+	}
+	else
+	{
+		kernel_slot = &kernel; // The ISR calls the kernel directly.
+	}
+
+	// Samples are compared to the trigger level in 10 bits.
+	trigger_threshold = resolution == 10 ? trigger_level: trigger_level << 2;
+
+	if(mode == ROLL_MODE) // If samples keep rolling in the history.
+	{
+		*kernel_slot = resolution == 10 ?
+			&Channel::roll<true>: &Channel::roll<false>;
+	}
+	else if(leader && leader != this) // If frames are frozen by another channel.
+	{
+		*kernel_slot = resolution == 10 ?
+			&Channel::follow<true>: &Channel::follow<false>;
+	}
+	else if(!(trigger_flags & TRIGGER_ON)) // If there is no triggering.
+	{
+		*kernel_slot = resolution == 10 ?
+			&Channel::capture<false, true>: &Channel::capture<false, false>;
+	}
+	else
+	{
+		bool up = trigger_flags & TRIGGER_SLOPE_UP;
+
+		if(mode == PEAK_DETECT_MODE) // If the trigger follows one of the peaks.
+		{
+			if(resolution == 10) // If samples are stored in 10 bits.
 			{
-				// Not enough memory to get the sample.
-				response->response_code_int = SERVICE_UNAVAILABLE_503;
+				armed_kernel = up ? &Channel::armed<true, true, true>:
+					&Channel::armed<false, true, true>;
 			}
 			else
 			{
-				// Set the sample as the body.
-				response->set_body(sample, MIME::APPLICATION_OCTET_STREAM);
+				armed_kernel = up ? &Channel::armed<true, false, true>:
+					&Channel::armed<false, false, true>;
 			}
+		}
+		else if(resolution == 10) // If samples are stored in 10 bits.
+		{
+			armed_kernel = up ? &Channel::armed<true, true, false>:
+				&Channel::armed<false, true, false>;
+		}
+		else
+		{
+			armed_kernel = up ? &Channel::armed<true, false, false>:
+				&Channel::armed<false, false, false>;
+		}
 
-			dispatch(response); // Dispatch the response to the client.
+		*kernel_slot = armed_kernel;
+	}
+
+	// Convert the position of the trigger into samples.
+	pre_trigger = (uint16_t)trigger_position * record_length / 100;
+
+	// At least one sample must follow the trigger.
+	if(pre_trigger > record_length - 2)
+	{
+		pre_trigger = record_length - 2;
+	}
+
+	/* Frames of packed samples start on a group of 4 and frames of peaks on
+	 * a pair of samples. */
+	alignment_mask = resolution == 10 ? 3: mode == PEAK_DETECT_MODE ? 1: 0;
+
+	/* The slope is verified against the two samples preceding the trigger.
+	 * When frames are aligned, they can start a few samples before the
+	 * requested position so those must be acquired as well. Peaks are
+	 * verified against the two preceding peaks of the same kind. */
+	uint8_t history = mode == PEAK_DETECT_MODE ? 4: 2;
+
+	arming_length = pre_trigger + alignment_mask;
+
+	if(arming_length < history)
+	{
+		arming_length = history;
+	}
+
+	// Restart acquisition.
+	sample_ptr = 0;
+	group_ptr = 0;
+	samples_left = record_length;
+	pre_trigger_left = arming_length;
+	armed_samples = 0;
+	completing = false;
+	dropping = false;
+	rolled = 0;
+	roll_length = 0;
+	measured = false; // The frames are acquired with other parameters.
+}
+
+void Channel::restart(void)
+{
+	if(!leader) // If every channel acquires on its own.
+	{
+		select_kernel();
+
+		return;
+	}
+
+	/* Synchronized channels restart together so they keep decimating and
+	 * storing samples at the same locations in their frames. */
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		if(instances[i]) // If that channel was created.
+		{
+			instances[i]->select_kernel();
 		}
 	}
-	else if(request) // If a request is waiting for a sample but none is ready.
+}
+
+void Channel::synchronize(uint8_t number)
+{
+	ATOMIC
 	{
-		schedule(1) // Process this resource again in 1 ms.
+		// A disabled channel cannot trigger for the others.
+		leader = number && instances[number - 1]->enabled ?
+			instances[number - 1]: NULL;
+
+		for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+		{
+			// Frames acquired on their own are no longer valid.
+			instances[i]->trigger_flags &= ~DONE_SAMPLE;
+			instances[i]->select_kernel(); // Restart acquisition.
+		}
+	}
+}
+
+void Channel::idle(uint16_t)
+{
+	// Samples are discarded.
+}
 
-		return; // Done.
+void Channel::decimate(uint16_t sample)
+{
+	accumulator += sample;
+
+	if(--decimation_left) // If there are samples left to accumulate.
+	{
+		return;
 	}
 
-	schedule(NEVER); // No requests waiting for a sample.
+	// Average the accumulated samples.
+	sample = accumulator >> decimation_shift;
+
+	accumulator = 0;
+	decimation_left = decimation;
+
+	(this->*decimated_kernel)(sample); // Store the average.
 }
 
-void Channel::store_sample(uint8_t sample)
+void Channel::detect_peaks(uint16_t sample)
 {
-	// Have to save the sample here to compare it with trigger.
-	sample_buffer[sample_ptr] = sample; // Save the sample.
+	if(sample < minimum) // If this is the lowest sample of the interval.
+	{
+		minimum = sample;
+	}
+
+	if(sample > maximum) // If this is the highest sample of the interval.
+	{
+		maximum = sample;
+	}
+
+	if(--decimation_left) // If the interval is not over.
+	{
+		return;
+	}
+
+	uint16_t high = maximum;
+
+	decimation_left = decimation;
+	maximum = 0;
+
+	// Store the peaks, the kernel can change after the first one.
+	(this->*decimated_kernel)(minimum);
+	minimum = 0xFFFF;
+	(this->*decimated_kernel)(high);
+}
 
-	/* When sampling has been restarted, sample_ptr is set to
-	 * extra_space + 1 so there is no danger of buffer overrun.*/
+/* Sample storing is split in kernels specialized for each trigger mode and
+ * resolution, the one in use is selected through a pointer. This way, the ISR
+ * does not test the trigger flags on every sample. Samples are saved in the
+ * frame as in a circular buffer, so there is no copy to do when it wraps
+ * around.*/
 
-	// If the trigger is on but has not been triggered yet.
-	if((trigger_flags & TRIGGER_ON) && !(trigger_flags & TRIGGERED) )
+template<bool wide> inline void Channel::save(uint16_t sample)
+{
+	if(wide) // If the sample is packed with 3 others in 5 bytes.
 	{
-		// If the trigger is on the up slope.
-		if(trigger_flags & TRIGGER_SLOPE_UP)
+		uint8_t* group = frames[acquiring] + group_ptr;
+		uint8_t slot = sample_ptr & 3; // The position of the sample in the group.
+
+		group[slot] = sample >> 2; // Save the 8 most significant bits.
+
+		/* Shift the 2 least significant bits in the last byte of the group,
+		 * after 4 samples, the first one's end up in bits 0 and 1. */
+		group[4] = (group[4] >> 2) | (sample << 6);
+
+		if(slot == 3) // If the group is complete.
 		{
-			// If the slope is not going up.
-			if(sample_buffer[sample_ptr] < sample_buffer[sample_ptr - 1] ||
-				sample_buffer[sample_ptr -1 ] < sample_buffer[sample_ptr - 2])
-			{
-				// Only keep the last two samples.
-				sample_buffer[sample_ptr - 2] = sample_buffer[sample_ptr - 1];
-				sample_buffer[sample_ptr - 1] = sample_buffer[sample_ptr];
+			group_ptr += 5; // Go to the next group.
+		}
+	}
+	else
+	{
+		frames[acquiring][sample_ptr] = sample >> 2; // Save the sample.
+	}
 
-				return; // No triggering.
-			}
+	if(++sample_ptr == record_length) // If the end of the buffer was reached.
+	{
+		sample_ptr = 0; // Wrap around.
+		group_ptr = 0;
+	}
+}
 
-			// If the sample is under the trigger level.
-			if(sample < trigger_level)
-			{
-				/// TODO same as above.
-				// Only keep the last two samples.
-				sample_buffer[sample_ptr - 2] = sample_buffer[sample_ptr - 1];
-				sample_buffer[sample_ptr - 1] = sample_buffer[sample_ptr];
+template<bool triggered, bool wide> void Channel::capture(uint16_t sample)
+{
+	save<wide>(sample); // Save the sample.
 
-				return; // No triggering.
-			}
+	if(--samples_left) // If the frame is not full.
+	{
+		return;
+	}
+
+	// The oldest sample is the one that would be overwritten next.
+	frame_starts[acquiring] = sample_ptr;
+
+	if(!triggered) // If acquisition was not started by the trigger.
+	{
+		trigger_ptrs[acquiring] = NO_TRIGGER;
+	}
+	else
+	{
+		trigger_flags &= ~TRIGGERED; // No longer triggered.
+
+		*kernel_slot = armed_kernel; // Wait for the trigger again.
+
+		pre_trigger_left = arming_length;
+	}
+
+	complete_frame();
+
+	samples_left = record_length;
+}
+
+template<bool slope_up, bool wide, bool peaks>
+	void Channel::armed(uint16_t sample)
+{
+	save<wide>(sample); // Save the sample.
+
+	/* Pairs of peaks start on even indexes, so the minimum of an interval
+	 * leaves the index odd. The slope is only followed on the maxima when it
+	 * goes up and on the minima when it goes down, the other peak is just
+	 * stored. */
+	if(peaks && (sample_ptr & 1) == slope_up)
+	{
+		if(pre_trigger_left)
+		{
+			pre_trigger_left--;
 		}
-		else // Else it is on the down slope.
+
+		return;
+	}
+
+	// If the part of the frame before the trigger has been filled.
+	if(!pre_trigger_left)
+	{
+		// If the slope is going the right way and the sample is past the level.
+		if(slope_up ?
+			sample >= last_sample && last_sample >= before_last_sample &&
+				sample >= trigger_threshold:
+			sample <= last_sample && last_sample <= before_last_sample &&
+				sample <= trigger_threshold)
 		{
-			// If the slope is not going down.
-			if(sample_buffer[sample_ptr] > sample_buffer[sample_ptr - 1] ||
-				sample_buffer[sample_ptr -1 ] > sample_buffer[sample_ptr - 2])
-			{
-				// Only keep the last two samples.
-				sample_buffer[sample_ptr - 2] = sample_buffer[sample_ptr - 1];
-				sample_buffer[sample_ptr - 1] = sample_buffer[sample_ptr];
+			trigger_flags |= TRIGGERED; // Triggering has occurred.
 
-				return;  // No triggering.
-			}
+			// The number of samples it took to trigger since it was armed.
+			stats.trigger_latency = armed_samples;
 
-			// If the sample is over the trigger level.
-			if(sample > trigger_level)
+			if(armed_samples > stats.trigger_latency_max)
 			{
-				/// TODO same as above.
-				// Only keep the last two samples.
-				sample_buffer[sample_ptr - 2] = sample_buffer[sample_ptr - 1];
-				sample_buffer[sample_ptr - 1] = sample_buffer[sample_ptr];
-
-				return;  // No triggering.
+				stats.trigger_latency_max = armed_samples;
 			}
+
+			armed_samples = 0;
+
+			// Keep what is needed to know the phase of the signal.
+			trigger_ptrs[acquiring] = sample_ptr;
+			trigger_samples[acquiring][0] = last_sample;
+			trigger_samples[acquiring][1] = sample;
+
+			// Save the samples that follow the trigger.
+			samples_left = record_length - pre_trigger - 1;
+
+			/* A frame of packed samples must start on a group and one of
+			 * peaks on a pair, so it gets completed up to a few samples later
+			 * or sooner than requested. */
+			uint8_t offset = (pre_trigger + 1 - sample_ptr) & alignment_mask;
+
+			// If the trigger would be pushed out of the frame.
+			samples_left += offset > pre_trigger ?
+				offset - alignment_mask - 1: offset;
+
+			*kernel_slot = &Channel::capture<true, wide>;
+
+			return;
 		}
 
-		trigger_flags |= TRIGGERED; // Triggering has occurred.
+		if(armed_samples != 0xFFFF) // Saturate instead of wrapping around.
+		{
+			armed_samples++;
+		}
 	}
+	else
+	{
+		pre_trigger_left--;
+	}
+
+	// Only keep the last two samples.
+	before_last_sample = last_sample;
+	last_sample = sample;
+}
 
-	sample_ptr++; // Start saving the sample.
+template<bool wide> void Channel::roll(uint16_t sample)
+{
+	save<wide>(sample); // Save the sample.
+
+	rolled++;
 
-	if(sample_ptr == sample_size + extra_space)
+	if(roll_length < record_length) // If the history is not full yet.
 	{
-		sample_ptr = extra_space - 1;
+		roll_length++;
+	}
+}
 
-		/* Copy the last "extra_space" bytes to the beginning of the sample
-		 * buffer so trigerring can be verified from the end of the last sample. */
-		memcpy(sample_buffer, sample_buffer + sample_size, extra_space);
-		trigger_flags &= ~DONE_SAMPLE; // Waiting for a new sample.
+template<bool wide> void Channel::follow(uint16_t sample)
+{
+	save<wide>(sample); // Save the sample.
+
+	if(samples_left) // If the frame has not been filled yet.
+	{
+		samples_left--;
 	}
 
-	if(sample_ptr == sample_size) // If a full sample has been acquired.
+	/* If the leader completed its frame and this one can start on a group
+	 * of samples or a pair of peaks as well. */
+	if(completing && !(sample_ptr & alignment_mask))
 	{
-		trigger_flags &= ~TRIGGERED; // No longer triggered.
+		completing = false;
+		freeze();
+	}
+}
+
+void Channel::freeze(void)
+{
+	if(samples_left) // If the frame was not filled since acquisition started.
+	{
+		return; // It is dropped.
+	}
+
+	// The oldest sample is the one that would be overwritten next.
+	frame_starts[acquiring] = sample_ptr;
+
+	trigger_ptrs[acquiring] = NO_TRIGGER; // The trigger was on the leader.
+
+	complete_frame();
+}
+
+void Channel::complete_frame(void)
+{
+	if(this == leader) // If this channel freezes the frames of every channel.
+	{
+		bool drop = false;
+
+		for(uint8_t i = 0; i < scan_length; i++)
+		{
+			// If the ready frame of a channel is still being sent.
+			if(scan[i]->references[!scan[i]->acquiring])
+			{
+				drop = true;
+			}
+		}
+
+		if(!drop)
+		{
+			sync_sequence++; // These frames belong together.
+		}
+
+		bool after = false; // If the channel is converted after this one.
+
+		/* The frames of every channel are frozen even when they are dropped,
+		 * so their segments stay in step. */
+		for(uint8_t i = 0; i < scan_length; i++)
+		{
+			scan[i]->dropping = drop;
+
+			if(scan[i] == this)
+			{
+				after = true;
+			}
+			/* If its sample for this scan is not acquired yet or its frame
+			 * would not start on a group of samples or a pair of peaks. */
+			else if(after || scan[i]->sample_ptr & scan[i]->alignment_mask)
+			{
+				scan[i]->completing = true; // Freeze after the next one.
+			}
+			else
+			{
+				scan[i]->freeze();
+			}
+		}
+	}
+
+	uint8_t frame = acquiring; // The frame that was completed.
+
+	if(dropping) // If the frame is dropped with the rest of its set.
+	{
+		dropping = false;
+		dropped++;
+	}
+	// If the frame that was ready is no longer being sent.
+	else if(!references[!acquiring])
+	{
+		// The frames frozen with the same number were acquired together.
+		frame_syncs[acquiring] = sync_sequence;
+
+		frame_times[acquiring] = get_uptime();
+
+		// If the frame about to be overwritten was never read.
+		if(trigger_flags & DONE_SAMPLE && !frame_read)
+		{
+			stats.unread++;
+		}
+
+		acquiring = !acquiring; // Freeze the frame and switch to the other one.
 		trigger_flags |= DONE_SAMPLE; // Done acquiring a sample.
+		sequence++; // This is a new frame.
+		frame_read = false;
+		stats.frames++;
 
-		/* Let acquisition go for another "extra_sample" before starting a
-		 * new one, this will give enough time for clients to get the last
-		 * sample. Here, a queue to keep samples cannot be because as
-		 * well as consuming too much memory, it could introduce a lag.*/
+		if(wake_on_frame) // If the resource is waiting for a frame.
+		{
+			wake_on_frame = false;
+			schedule(0); // Run it right away.
+		}
+
+		// If the synchronized acquisition is waiting for frames.
+		if(waiting_acquisition)
+		{
+			waiting_acquisition->wake();
+			waiting_acquisition = NULL;
+		}
+	}
+	else
+	{
+		/* The acquired frame is dropped and acquisition restarts in it.
+		 * Here, a queue to keep samples cannot be because as well as consuming
+		 * too much memory, it could introduce a lag.*/
+		dropped++;
+	}
 
-		/// TODO use a variable instead of extra space to pause acquisition.
+	if(segments) // If frames are kept in segments.
+	{
+		store_segment(frame); // Whether the ready frame is being sent or not.
 	}
 }
 
 ISR(ADC_vect)
 {
-	/* Since we are in free-running mode, the interrupt retriggers the conversion
-	 * automatically (on a rising edge) and then proceeds to the service routine.
-	 * From that point on, we have only one ADC clock (varies according to the prescaler
-	 * value) to switch channel before conversion starts again and locks ADMUX.
+	uint16_t entry = TCNT1; // When the ISR started, in timer ticks.
+
+	/* Clear the compare match flag, otherwise its next rising edge will not be
+	 * seen and no other conversion will be started. */
+	TIFR1 = _BV(OCF1B);
+
+	if(!scan_length) // If every channel is disabled.
+	{
+		return;
+	}
+
+	// The channel that was just converted.
+	Channel* channel = scan[scan_ptr];
+
+	// Move to the next enabled channel, going back to the first after the last.
+	if(++scan_ptr == scan_length)
+	{
+		scan_ptr = 0;
+	}
+
+	/* Since conversions are started by timer 1, the next conversion will only
+	 * begin on the next compare match. The input can therefore be switched
+	 * safely for the next channel.
 	 * ----------------------
 	 * See the MCU's datasheet chapter "Analog-to-Digital Conversion" section
 	 * "Changing Channel or Reference Selection".*/
+	ADMUX = (ADMUX & 0xF0) | scan_inputs[scan_ptr];
 
-	/*Selects only the first 4 bits of ADMUX in order to get an index of the channel
-	 * we are at.*/
-	uint8_t index = ADMUX & 0x0F;
+	/*Let the channel that was just converted store the acquired sample.*/
+	channel->store_sample(ADCW);
 
-	/*Switch channel, if the index is greater than the number of channels,
-	 * reset ADMUX:MUXx to channel 0, otherwise, increment it.*/
-	index >= NUMBER_OF_CHANNELS - 1 ? ADMUX &= 0xF0: ADMUX++;
+	// Time the ISR once in a while, so it stays cheap enough to always be on.
+	if(channel->count_conversion())
+	{
+		uint16_t exit = TCNT1;
 
-	/*Let the last channel store the acquired sample.*/
-	instances[index]->store_sample(ADCH);
+		// The timer may have been cleared on compare match in the meantime.
+		uint16_t ticks = exit >= entry ? exit - entry: exit + OCR1A + 1 - entry;
 
+		channel->time_isr(ticks * timer_prescaler);
+	}
 }
@@ -19,22 +19,157 @@
 #define CHANNEL_H_
 
 #include <core/resource.h>
+#include "stats.h"
 
-/// The number of channels on the oscilloscope.
+class Acquisition;
+class FrameHeaderFile;
+
+/** The number of channels on the oscilloscope. There are 6 inputs, but the
+ * channels must also fit in CHANNELS_RAM_BUDGET, which leaves room for about
+ * 3 of them. */
 #define NUMBER_OF_CHANNELS 2
 
+/** The RAM in bytes the channels can take out of the 2 KB of the MCU, the
+ * framework, the network stack, the stack and the heap get the rest. The
+ * build fails if the channels do not fit in it. */
+#define CHANNELS_RAM_BUDGET 1024
+
+/** The ADC input of each channel, the first channel's first. Only the first
+ * NUMBER_OF_CHANNELS inputs are used. */
+#define CHANNEL_INPUTS { 0, 1, 2, 3, 4, 5 }
+
+/// The size in bytes of the memory reserved for the frames of all channels.
+#define FRAME_MEMORY 500
+
+/** The size in bytes of the memory reserved for the frames of each channel,
+ * an even share of FRAME_MEMORY. With 2 channels, frames of the default length
+ * fit in it twice in 10 bits. A frame that does not fit in what is left is
+ * allocated on the heap. */
+#define FRAME_POOL_SIZE (FRAME_MEMORY / NUMBER_OF_CHANNELS)
+
+/// The voltage of the ADC reference in millivolts, AVcc.
+#define ADC_REFERENCE 5000
+
+/// The measurements of a frame, in fixed point.
+struct measurements_t
+{
+	/// The sequence number of the frame measured.
+	uint16_t sequence;
+
+	/// The frequency of the signal in millihertz, 0 if it is unknown.
+	uint32_t frequency;
+
+	/// The period of the signal in microseconds, 0 if it is unknown.
+	uint32_t period;
+
+	/// The lowest sample in millivolts.
+	uint16_t min;
+
+	/// The highest sample in millivolts.
+	uint16_t max;
+
+	/// The average of the samples in millivolts.
+	uint16_t mean;
+
+	/// The root mean square of the samples in millivolts.
+	uint16_t rms;
+
+	/// The portion of a period the signal is high in thousandths.
+	uint16_t duty;
+};
+
+/// The metadata of a segment, see Channel::segments.
+struct segment_t
+{
+	/// The uptime when the segment was completed.
+	uptime_t time;
+
+	/// The sampling rate of the channel when the segment was acquired.
+	uint16_t rate;
+
+	/// The decimation of the segment, as a shift.
+	uint8_t decimation_shift;
+
+	/// The position of the oldest sample in the segment.
+	uint8_t start;
+
+	/// The index of the sample that triggered, NO_TRIGGER if none did.
+	uint8_t trigger;
+
+	/// FRAME_PEAKS if the segment holds pairs of peaks.
+	uint8_t flags;
+};
+
 /**
  * This resource is a signal acquisition channel.
  * The following are the list of sub-resources defined inside the class:
- * - /: sample data octet stream
+ * - /: sample data octet stream preceded by its metadata (see FrameHeaderFile),
+ *   its entity tag is the frame's sequence number
+ *    - ec: encoding, "delta" for a compressed stream (argument)
+ *    - since: a sequence number, the request waits until another frame is
+ *      ready and gets a 304 if none is before it times out (argument)
+ * - /stream: sample data octet streams preceded by their metadata, sent in
+ *   chunks as frames get completed
+ * - /roll: in roll mode, the samples acquired since an index preceded by
+ *   their metadata, the index of the first one is its sequence number
+ *    - from: the index following the last sample the client has, the whole
+ *      history is sent if it is missing or too old (argument)
+ * - /ms: measurements JSON object of the frame that is ready (GET), voltages
+ *   are in mV, the frequency in mHz, the period in us and the duty cycle in
+ *   thousandths. The period is found from the crossings of the middle of
+ *   the signal, the frequency, period and duty cycle are 0 if fewer than 2
+ *   of them are rising in the frame.
+ * - /fft: the spectrum of the newest samples of the frame that is ready,
+ *   preceded by its metadata (see SpectrumFile). It is computed by run(),
+ *   the request waits until then.
+ *    - wn: window, "hann" or "flattop", none if missing (argument)
+ * - /seg: the number of segments and how many were filled, JSON object
+ *   (GET)
+ * - /seg/<i>: sample data octet stream of segment i preceded by its
+ *   metadata, the sequence number is i and the timestamp is when it was
+ *   filled (GET)
  * - /pr: parameters JSON array (GET)
  *    - sr: sampling rate (argument)
  *    - tl: trigger level (argument)
  *    - tf: trigger flags (argument)
+ *    - pt: pre-trigger, the position of the trigger in the frame in % (argument)
+ *    - rl: record length, the number of samples in a frame (argument)
+ *    - dc: decimation, the number of samples averaged into one (argument)
+ *    - rs: resolution, 8 or 10 bits per sample (argument)
+ *    - am: acquisition mode (argument)
+ *       - 0: normal, decimated samples are averaged.
+ *       - 1: peak detect, the lowest and highest samples of each decimation
+ *         interval are stored in pairs.
+ *       - 2: roll, decimated samples are averaged and kept in a history
+ *         that is never frozen into frames and does not trigger.
+ *    - av: averaging, the number of frames averaged into the one published
+ *      (argument)
+ *    - et: equivalent-time, the number of frames interleaved into the one
+ *      published when triggering is on in normal mode, av is then ignored
+ *      (argument)
+ *    - en: enabled, 0 to stop converting the channel so the others share
+ *      the ADC, 1 to convert it again (argument)
+ *    - sg: segments, the number of frames kept one after the other as they
+ *      get completed, 0 to keep none. Posting it or another record length or
+ *      resolution empties them (argument)
+ *
+ * In 10 bits resolution, the sample data is packed in groups of 4 samples
+ * taking 5 bytes: the 8 most significant bits of each sample followed by a
+ * byte holding their 2 least significant bits, the first sample's in bits
+ * 0 and 1.
  *
  * */
 class Channel: public Resource
 {
+	/// Stream files need to access the frames.
+	friend class StreamFile;
+
+	/// The synchronized acquisition needs to access the frames of every channel.
+	friend class Acquisition;
+
+	/// The statistics need to read the counters.
+	friend class StatsFile;
+
 	public:
 
 		// Cannot be accessed from within the ISR.
@@ -46,27 +181,171 @@ class Channel: public Resource
 		/// The delay after which a request expires.
 		static const uptime_t max_request_age = 1000;
 
-		/// The size in bytes of a sample.
-		static const uint8_t sample_size = 100;
+		/// The length in samples of a frame when the channel starts.
+		static const uint8_t default_record_length = 100;
+
+		/// The shortest frame that gets allocated when memory is scarce.
+		static const uint8_t min_record_length = 8;
 
-		/** The amount of extra space after the end of the buffer. */
-		static const uint8_t extra_space = 20;
+		/** The largest decimation factor, the sum of that many 10 bits samples
+		 * fits in the accumulator. */
+		static const uint8_t max_decimation = 64;
 
-		/** The sampling rate in samples / second. This value is configurable
+		/** The largest number of frames averaged, the sum of that many 10 bits
+		 * samples fits in 16 bits. */
+		static const uint8_t max_sweeps = 64;
+
+		/// The largest number of frames interleaved, one bit per phase.
+		static const uint8_t max_interleave = 8;
+
+		/// The largest number of segments.
+		static const uint8_t max_segments = 64;
+
+		/// The number of the channel, starting from 1.
+		uint8_t number;
+
+		/// The ADC input the channel converts, see CHANNEL_INPUTS.
+		uint8_t input;
+
+		/** If the channel is converted by the ADC. This value is configurable
 		 * through the web interface. */
-		uint16_t sampling_rate;
+		bool enabled;
+
+		/** The length in samples of a frame. This value is configurable through
+		 * the web interface and negotiated against the memory available. */
+		uint8_t record_length;
+
+		/** The number of samples from the ADC averaged into each sample of the
+		 * frame, always a power of two. This value is configurable through the
+		 * web interface.*/
+		uint8_t decimation;
 
-		/// The location where sampling is at in the sample buffer.
+		/** The number of bits per sample in the frames, 8 or 10. This value is
+		 * configurable through the web interface. */
+		uint8_t resolution;
+
+		/// Decimated samples are averaged.
+		#define NORMAL_MODE 0
+
+		/// The lowest and highest samples of each decimation interval are kept.
+		#define PEAK_DETECT_MODE 1
+
+		/// Decimated samples are averaged into a history that keeps rolling.
+		#define ROLL_MODE 2
+
+		/** The acquisition mode. This value is configurable through the web
+		 * interface. */
+		uint8_t mode;
+
+		/** The sampling rate in samples / second actually achieved by the
+		 * hardware. This value is configurable through the web interface. Since
+		 * all channels share the ADC and the timer that starts conversions,
+		 * it is the same for every enabled channel.*/
+		static uint16_t sampling_rate;
+
+		/// The location where sampling is at in the frame being acquired.
 		volatile uint8_t sample_ptr;
 
-		/// The buffer that holds the sample.
-		uint8_t sample_buffer[sample_size + extra_space];
-		/* This buffer is declared statically for the reason that there
-		 * is always a minimum of two sample holding buffers in existence. This
-		 * one, where the current sample is being saved, an another dynamically
-		 * allocated that is being sent to a client that requested it. Since we
-		 * always need a buffer to hold the current sample it saves memory
-		 * an processing time to always have it in place. */
+		/** In 10 bits resolution, the location in bytes of the group of 4
+		 * samples where sampling is at. */
+		uint16_t group_ptr;
+
+		/// The number of samples left to acquire before the frame is full.
+		uint8_t samples_left;
+
+		/// The position of the trigger in the frame, in %.
+		uint8_t trigger_position;
+
+		/// The number of samples to keep in the frame before the trigger.
+		uint8_t pre_trigger;
+
+		/** The alignment of the start of a frame in samples, minus one. */
+		uint8_t alignment_mask;
+
+		/** The number of samples to acquire once the trigger is armed before
+		 * triggering can be verified. */
+		uint8_t arming_length;
+
+		/** The number of samples left to acquire before the pre-trigger part of
+		 * the frame is filled and triggering can be verified. */
+		uint8_t pre_trigger_left;
+
+		/// The index of the frame being acquired, the other one is ready.
+		volatile uint8_t acquiring;
+
+		/// The sequence number of the ready frame, incremented for every new one.
+		volatile uint16_t sequence;
+
+		/// The ping-pong buffers that hold the frames.
+		uint8_t* frames[2];
+		/* While the ISR saves samples in one frame, the last completed one is
+		 * frozen and handed out without being copied to every client that
+		 * requested it. When acquisition is done, the ISR simply switches to
+		 * the other frame if it is no longer being sent. Frames are circular
+		 * buffers so samples preceding the trigger can be kept. They are
+		 * allocated on the heap since their size is configurable. */
+
+		/** The memory reserved for the frames, so the usual ones do not take
+		 * space on the heap that could be left fragmented. */
+		uint8_t frame_pool[FRAME_POOL_SIZE];
+
+		/** The memory of each frame, a frame points to a segment instead
+		 * while it is acquired in one. */
+		uint8_t* buffers[2];
+
+		/// The position of the oldest sample in each frame.
+		uint8_t frame_starts[2];
+
+		/// The number of files referencing each frame.
+		volatile uint8_t references[2];
+
+		/** In roll mode, the index of the next sample, the frame being
+		 * acquired holds the history of the samples before it. */
+		volatile uint16_t rolled;
+		/* Indexes wrap around at a multiple of 4, so an index and its
+		 * position in the frame are at the same place in a group of 4. */
+
+		/// In roll mode, the number of samples in the history.
+		volatile uint8_t roll_length;
+
+		/** The last two samples, kept out of the frame while the trigger is
+		 * armed so the slope can be verified without reading the buffer. */
+		uint16_t last_sample;
+		uint16_t before_last_sample; ///< See last_sample.
+
+		/// A sample storing kernel.
+		typedef void (Channel::*kernel_t)(uint16_t sample);
+
+		/** The sample storing kernel called by the ISR. It is changed when
+		 * the parameters are set or triggering occurs. */
+		kernel_t kernel;
+
+		/** When samples are decimated, the kernel the decimated samples are
+		 * passed to. */
+		kernel_t decimated_kernel;
+
+		/** Where kernels should store the next kernel for the trigger
+		 * configuration, either kernel or decimated_kernel. */
+		kernel_t* kernel_slot;
+
+		/** The kernel that waits for the trigger in the configuration, capture
+		 * goes back to it once a triggered frame is full. */
+		kernel_t armed_kernel;
+
+		/// The sum of the samples being decimated.
+		uint16_t accumulator;
+
+		/// In peak detect mode, the lowest sample of the interval.
+		uint16_t minimum;
+
+		/// In peak detect mode, the highest sample of the interval.
+		uint16_t maximum;
+
+		/// The number of samples left to accumulate before decimating.
+		uint8_t decimation_left;
+
+		/// The power of two of the decimation factor.
+		uint8_t decimation_shift;
 
 		/// Sample acquisition is done.
 		#define DONE_SAMPLE _BV(3)
@@ -92,12 +371,147 @@ class Channel: public Resource
 		 * */
 		volatile uint8_t trigger_flags;
 
-		/// The level in ADC units at which triggering should occur.
+		/** The level in ADC units at which triggering should occur, at the
+		 * resolution of the channel. */
 		volatile uint16_t trigger_level;
 
+		/// The trigger level in 10 bits ADC units.
+		uint16_t trigger_threshold;
+
+		/** The number of frames averaged into the one published, always a
+		 * power of two. This value is configurable through the web interface. */
+		uint8_t sweeps;
+
+		/// The power of two of the number of frames averaged.
+		uint8_t sweeps_shift;
+
+		/// The number of frames left to add to the sums before averaging them.
+		uint8_t sweeps_left;
+
+		/** The sum of each sample of the frames being averaged, or the samples
+		 * of the composite frame. */
+		uint16_t* sums;
+		/* Frames are summed by run() rather than the ISR, adding a whole frame
+		 * would take longer than the interval between two samples. */
+
+		/** The average of the last frames or the composite frame, laid out
+		 * like an unrotated frame. */
+		uint8_t* average;
+
+		/// The number of files referencing the average or composite frame.
+		volatile uint8_t average_references;
+
+		/// The sequence number of the last frame combined.
+		uint16_t summed_sequence;
+
+		/// The sequence number of the average, incremented for every new one.
+		uint16_t average_sequence;
+
+		/// If an average is ready.
+		bool average_ready;
+
+		/** The number of frames interleaved into a composite frame, always a
+		 * power of two. This value is configurable through the web interface. */
+		uint8_t interleave;
+		/* Conversions are started by a timer so sample instants are exact,
+		 * but the signal is not synchronized with them. The moment it crossed
+		 * the trigger level is interpolated between the samples around the
+		 * trigger, which tells how far into a sample period each triggered
+		 * frame was acquired. Frames sorted by that phase are combined into a
+		 * composite frame sampled interleave times faster. */
+
+		/// The phases that were acquired in the composite frame, one bit each.
+		uint8_t interleaved_bins;
+
+		/// The measurements of the last frame measured.
+		measurements_t measurements;
+		/* Measuring a frame takes a few passes over it, so it is only done
+		 * when a client asks for it and at most once per frame. */
+
+		/// If the measurements are of a frame acquired with the parameters.
+		bool measured;
+
+		/** The frames completed since the segments were emptied, one after
+		 * the other, followed by their metadata. */
+		uint8_t* segments;
+		/* The ping-pong frames lose every frame completed while the ready
+		 * one is being sent, so bursts of triggers go unseen. Each frame is
+		 * acquired straight into the next segment and kept there once it is
+		 * completed, so they are all kept until the segments are full
+		 * without the ISR copying anything. */
+
+		/// The metadata of the segments, stored after them.
+		segment_t* segment_info;
+
+		/** The number of segments. This value is configurable through the
+		 * web interface. */
+		uint8_t segment_count;
+
+		/// The number of segments filled.
+		volatile uint8_t segments_filled;
+
+		/// The number of files referencing the segments.
+		volatile uint8_t segment_references;
+
+		/** For each frame, the location in the frame after the trigger,
+		 * NO_TRIGGER if the frame was not triggered. */
+		uint8_t trigger_ptrs[2];
+
+		/// For each frame, the samples before and at the trigger.
+		uint16_t trigger_samples[2][2];
+
+		/** The channel whose trigger freezes the frames of every channel, NULL
+		 * if each channel triggers on its own. */
+		static Channel* leader;
+
+		/// Incremented every time the leader freezes the frames.
+		static uint16_t sync_sequence;
+
+		/** For each frame, the value of sync_sequence when it was frozen. The
+		 * frames of all channels that have the same value were frozen at the
+		 * same scan of the ADC. */
+		uint16_t frame_syncs[2];
+
+		/** If the leader completed its frame and this channel's needs to be
+		 * frozen after its next sample. */
+		bool completing;
+
+		/** If the frame frozen by the leader is dropped with the rest of its
+		 * set, because the ready frame of a channel is still being sent. */
+		bool dropping;
+
+		/** If the ISR should schedule the resource when a frame is completed,
+		 * so it does not need to poll for frames. */
+		volatile bool wake_on_frame;
+
+		/// The synchronized acquisition to wake up when a frame is completed.
+		static Acquisition* volatile waiting_acquisition;
+
+		/// The number of frames dropped because the ready one was being sent.
+		volatile uint16_t dropped;
+
+		/// If the ready frame was read since it was completed.
+		volatile bool frame_read;
+
+		/// The counters measuring the performance of the channel.
+		channel_stats_t stats;
+
+		/** The number of samples acquired since the trigger was armed and
+		 * could fire. */
+		uint16_t armed_samples;
+
+		/// For each frame, the uptime when it was completed.
+		uptime_t frame_times[2];
+
+		/// The uptime when the average or composite frame was published.
+		uptime_t average_time;
+
 		/// The queue were requests are kept.
 		Queue<Request*> queue;
 
+		/// The queue were requests for a spectrum are kept.
+		Queue<Request*> spectrum_queue;
+
 	public:
 
 		/**
@@ -118,14 +532,69 @@ class Channel: public Resource
          */
 		virtual Response::status_code process(Request* request, Response* response);
 
+		/**
+		 * Process a request message, see process().
+		 * @param request the request to process.
+		 * @param response the response to fill.
+		 * @return the status_code produced while processing the request.
+		 */
+		Response::status_code handle(Request* request, Response* response);
+
 		/// Does processing on the resource.
 		virtual void run(void);
 
+		/**
+		 * Schedule the resource so it sleeps until a frame is completed or
+		 * the oldest request waiting for one times out.
+		 * */
+		void schedule_wakeup(void);
+
 		/**
 		 * Get the most recent sample.
+		 * @param request the request for the sample, if its ec argument is
+		 * "delta", the sample is compressed (see DeltaFrameFile).
+		 * @param response the response the sample's entity tag is added to.
 		 * @return a file containing the most recent sample.
 		 * */
-		File* get_sample(void);
+		File* get_sample(Request* request, Response* response);
+
+		/**
+		 * @param frame the index of a frame.
+		 * @return the index of the sample at the trigger from the oldest one,
+		 * NO_TRIGGER if the frame was not triggered.
+		 * */
+		uint8_t trigger_index(uint8_t frame);
+
+		/**
+		 * @param rate a sampling rate in samples / second.
+		 * @param shift the decimation, as a shift.
+		 * @return the rate once decimated, in millihertz.
+		 * */
+		static uint32_t frame_rate(uint16_t rate, uint8_t shift);
+
+		/**
+		 * @param request a request for a sample.
+		 * @return if a sample the request has not seen yet is ready, according
+		 * to its since argument.
+		 * */
+		bool is_new(Request* request);
+
+		/**
+		 * Get the ready frame, or the average when frames are averaged,
+		 * preceded by its metadata.
+		 * @param compressed if the frame should be compressed.
+		 * @return a file containing the ready frame.
+		 * */
+		FrameHeaderFile* get_frame(bool compressed);
+
+		/**
+		 * Get the samples acquired in roll mode since an index, preceded by
+		 * their metadata.
+		 * @param from the index following the last sample the client has.
+		 * @param all if the whole history should be sent instead.
+		 * @return a file containing the samples.
+		 * */
+		File* get_roll(uint16_t from, bool all);
 
 		/**
 		 * Get the current parameters for the channel.
@@ -133,14 +602,286 @@ class Channel: public Resource
 		 * */
 		File* get_params(void);
 
+		/**
+		 * Get the measurements of the frame that is ready, it gets measured
+		 * unless it already was.
+		 * @return a file containing the measurements.
+		 * */
+		File* get_measurements(void);
+
+		/// Measure the frame that is ready, see measurements_t.
+		void measure(void);
+
+		/**
+		 * Get the spectrum of the frame that is ready, preceded by its
+		 * metadata.
+		 * @param request the request for the spectrum.
+		 * @return a file containing the spectrum.
+		 * */
+		File* get_spectrum(Request* request);
+
+		/// Send their spectrum to the requests waiting for one.
+		void send_spectra(void);
+
+		/**
+		 * Check if a spectrum can be computed. Combined frames are transformed
+		 * in the sums, so their spectrum waits until one is published unless
+		 * the request would time out.
+		 * @param request the request for the spectrum.
+		 * @return if the spectrum can be computed.
+		 * */
+		bool spectrum_ready(Request* request);
+
+		/**
+		 * Build the list of the channels the ADC converts in turn, only the
+		 * enabled ones. Must be called with interrupts disabled.
+		 * */
+		static void scan_channels(void);
+
+		/**
+		 * Configure the timer that starts ADC conversions so each enabled
+		 * channel gets sampled as close as possible to the requested rate.
+		 * @param rate the requested sampling rate per channel in samples / second.
+		 * @return the sampling rate per channel achieved by the hardware.
+		 * */
+		static uint16_t set_sampling_rate(uint16_t rate);
+
+		/**
+		 * Reallocate the frames to a new length and resolution. If there is
+		 * not enough memory for the requested length, it is halved until the
+		 * frames fit. Nothing is changed while a frame or the average is being
+		 * sent.
+		 * @param length the requested length of a frame in samples.
+		 * @param bits the number of bits per sample, 8 or 10.
+		 * */
+		void configure_frames(uint8_t length, uint8_t bits);
+
+		/**
+		 * Allocate the frames at the current length and resolution, from the
+		 * memory reserved for them if they fit in it.
+		 * @return if both frames could be allocated.
+		 * */
+		bool allocate_frames(void);
+
+		/// Free the frames that were allocated on the heap.
+		void free_frames(void);
+
+		/**
+		 * @return the size in bytes of a frame at the current resolution.
+		 * */
+		uint16_t frame_size(void);
+
+		/**
+		 * Reallocate the buffers used to average or interleave frames and
+		 * restart combining them. If there is not enough memory, frames are
+		 * published as they are acquired. Nothing is changed while the average
+		 * is being sent.
+		 * @param count the requested number of frames to average, it is
+		 * rounded down to a power of two.
+		 * @param factor the requested number of frames to interleave, it is
+		 * rounded down to a power of two.
+		 * */
+		void configure_sweeps(uint8_t count, uint8_t factor);
+
+		/// Restart averaging or interleaving from the next frame.
+		void restart_sweeps(void);
+
+		/**
+		 * Empty the segments, reallocating them if their number changes. If
+		 * there is not enough memory, none are kept. Nothing is changed while
+		 * a segment is being sent.
+		 * @param count the number of segments.
+		 * */
+		void configure_segments(uint8_t count);
+
+		/**
+		 * Keep the frame that was just completed if it was acquired in the
+		 * next segment, then acquire in the following one or in the frame's
+		 * own memory once they are all filled.
+		 * @param frame the index of the frame that was completed.
+		 * */
+		inline void store_segment(uint8_t frame);
+
+		/**
+		 * Get a segment, preceded by its metadata.
+		 * @param index the index of the segment.
+		 * @return a file containing the segment.
+		 * */
+		File* get_segment(uint8_t index);
+
+		/**
+		 * Combine the ready frame if it was not yet. It is either added to the
+		 * sums, which get averaged once enough frames were added, or binned
+		 * into the composite frame, which gets published once every phase was
+		 * acquired.
+		 * */
+		void combine_frame(void);
+
+		/**
+		 * Pack the sums into the frame that gets published, unless the last
+		 * one is still being sent.
+		 * @param shift the power of two the sums are divided by.
+		 * */
+		void publish(uint8_t shift);
+
+		/**
+		 * @return if frames are interleaved into a composite frame.
+		 * */
+		bool interleaved(void);
+
+		/**
+		 * @return if no frame was combined since the last one was published,
+		 * the sums can then be used for something else until the next one.
+		 * */
+		bool sums_empty(void);
+
+		/**
+		 * @return if a frame is ready to be published, the average or the
+		 * composite frame when frames are combined.
+		 * */
+		bool frame_ready(void);
+
+		/**
+		 * @return the sequence number of the frame published.
+		 * */
+		uint16_t frame_sequence(void);
+
+		/**
+		 * Select the sample storing kernels that match the parameters and
+		 * restart acquisition. Must be called with interrupts disabled.
+		 * */
+		void select_kernel(void);
+
+		/**
+		 * Restart acquisition on this channel, or on every channel if they are
+		 * synchronized. Must be called with interrupts disabled.
+		 * */
+		void restart(void);
+
+		/**
+		 * Sample storing kernel that discards samples, used while there are
+		 * no frames to store them into.
+		 * @param sample the sample just acquired by the ADC, in 10 bits.
+		 * */
+		void idle(uint16_t sample);
+
+		/**
+		 * Sample storing kernel that averages samples and passes the result
+		 * to decimated_kernel.
+		 * @param sample the sample just acquired by the ADC, in 10 bits.
+		 * */
+		void decimate(uint16_t sample);
+
+		/**
+		 * Sample storing kernel that finds the lowest and highest samples of
+		 * each decimation interval and passes them to decimated_kernel.
+		 * @param sample the sample just acquired by the ADC, in 10 bits.
+		 * */
+		void detect_peaks(uint16_t sample);
+
+		/**
+		 * Sample storing kernel that saves samples in the frame until it is
+		 * full.
+		 * @param triggered if the frame was started by a trigger, in which case
+		 * the trigger gets armed again once it is full.
+		 * @param wide if samples are stored in 10 bits.
+		 * @param sample the sample just acquired by the ADC, in 10 bits.
+		 * */
+		template<bool triggered, bool wide> void capture(uint16_t sample);
+
+		/**
+		 * Sample storing kernel that keeps saving samples in the frame while
+		 * waiting for the trigger.
+		 * @param slope_up if triggering is on the up slope.
+		 * @param wide if samples are stored in 10 bits.
+		 * @param peaks if samples are pairs of peaks, in which case only the
+		 * maxima are compared when triggering on the up slope and the minima
+		 * on the down slope, once per interval.
+		 * @param sample the sample just acquired by the ADC, in 10 bits.
+		 * */
+		template<bool slope_up, bool wide, bool peaks>
+			void armed(uint16_t sample);
+
+		/**
+		 * Save a sample in the frame being acquired and move to the next
+		 * location, wrapping around at the end of the frame.
+		 * @param wide if the sample is stored in 10 bits.
+		 * @param sample the sample to save, in 10 bits.
+		 * */
+		template<bool wide> inline void save(uint16_t sample);
+
+		/**
+		 * Sample storing kernel that keeps saving samples in the frame being
+		 * acquired, which is never completed, for roll mode.
+		 * @param wide if samples are stored in 10 bits.
+		 * @param sample the sample just acquired by the ADC, in 10 bits.
+		 * */
+		template<bool wide> void roll(uint16_t sample);
+
+		/**
+		 * Sample storing kernel that keeps saving samples in the frame until
+		 * the leader's frame gets completed.
+		 * @param wide if samples are stored in 10 bits.
+		 * @param sample the sample just acquired by the ADC, in 10 bits.
+		 * */
+		template<bool wide> void follow(uint16_t sample);
+
+		/**
+		 * Complete the frame of a channel following the leader, unless it was
+		 * not filled since acquisition started.
+		 * */
+		void freeze(void);
+
+		/**
+		 * Freeze the frame just acquired and switch to the other one if it
+		 * is no longer being sent. When this channel is the leader, the frames
+		 * of the other channels are frozen at the same scan.
+		 * */
+		void complete_frame(void);
+
 	public:
 
 		/**
 		 * Store a sample from the ADC. This method is meant to be called from
 		 * the ADC's interrupt service routine.
-		 * @param sample the sample just acquired by the ADC.
+		 * @param sample the sample just acquired by the ADC, in 10 bits.
+		 * */
+		inline void store_sample(uint16_t sample) { (this->*kernel)(sample); }
+
+		/**
+		 * Count a conversion of this channel. This method is meant to be
+		 * called from the ADC's interrupt service routine.
+		 * @return if the interrupt service routine should be timed.
+		 * */
+		inline bool count_conversion(void)
+		{
+			return !(++stats.conversions & ISR_TIMING_MASK);
+		}
+
+		/**
+		 * Record how long the interrupt service routine took.
+		 * @param cycles the duration of the routine in CPU cycles.
+		 * */
+		inline void time_isr(uint16_t cycles)
+		{
+			if(cycles > stats.isr_max)
+			{
+				stats.isr_max = cycles;
+			}
+
+			stats.isr_total += cycles;
+			stats.isr_timed++;
+		}
+
+		/**
+		 * Make the trigger of a channel freeze the frames of every channel at
+		 * the same scan of the ADC, the other channels stop triggering. This
+		 * restarts acquisition on every channel.
+		 * @param number the number of the channel that triggers, starting
+		 * from 1, or 0 so each channel triggers on its own. A disabled
+		 * channel does not trigger.
 		 * */
-		void store_sample(uint8_t sample);
+		static void synchronize(uint8_t number);
 };
 
 #endif /* CHANNEL_H_ */
@@ -0,0 +1,179 @@
+/* delta_frame_file.cpp - Implements a compressed file over a shared sample frame
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "delta_frame_file.h"
+
+/// The largest number of deltas coded by a run token.
+#define MAX_RUN 64
+
+/// Maps a signed delta to an unsigned value, small magnitudes staying small.
+#define ZIGZAG(d) ((uint16_t)(((uint16_t)(d) << 1) ^ ((d) >> 15)))
+
+DeltaFrameFile::DeltaFrameFile(const uint8_t* data, size_t length, size_t start,
+	volatile uint8_t* references, bool wide):
+	FrameFile(data, length, start, references),
+	wide(wide),
+	samples(wide ? length / 5 * 4: length)
+{
+	size = 0;
+
+	rewind();
+
+	/* Encode the whole frame once to know the size of the file, the frame
+	 * does not change while it is referenced. */
+	while(next < samples)
+	{
+		encode();
+		size += token_length;
+	}
+
+	rewind();
+}
+
+void DeltaFrameFile::rewind(void)
+{
+	next = 0;
+	previous = 0;
+	delta = 0;
+	token_length = 0;
+	token_ptr = 0;
+	_cursor = 0;
+}
+
+uint16_t DeltaFrameFile::sample(uint16_t index)
+{
+	return unpack(data, frame_length, start, index, wide);
+}
+
+void DeltaFrameFile::encode(void)
+{
+	token_ptr = 0;
+
+	if(!next) // If this is the first sample.
+	{
+		previous = sample(next++);
+
+		// It is sent as is.
+		token[0] = previous >> 8;
+		token[1] = previous;
+		token_length = 2;
+
+		return;
+	}
+
+	uint16_t current = sample(next);
+	int16_t d = current - previous;
+
+	if(d == delta) // If the previous delta repeats.
+	{
+		uint8_t run = 0;
+
+		// Count how many times it repeats.
+		do
+		{
+			previous = current;
+			next++;
+			run++;
+
+			if(next == samples || run == MAX_RUN) // If the run must end.
+			{
+				break;
+			}
+
+			current = sample(next);
+		}
+		while((int16_t)(current - previous) == delta);
+
+		token[0] = 0x40 | (run - 1);
+		token_length = 1;
+
+		return;
+	}
+
+	uint16_t zigzag = ZIGZAG(d);
+
+	// If the delta is small and so is the next one.
+	if(zigzag < 8 && next + 1 < samples)
+	{
+		uint16_t following = sample(next + 1);
+		int16_t d2 = following - current;
+		uint16_t zigzag2 = ZIGZAG(d2);
+
+		if(zigzag2 < 8 && d2 != d) // If both can share a byte.
+		{
+			token[0] = (zigzag << 3) | zigzag2;
+			token_length = 1;
+
+			previous = following;
+			delta = d2;
+			next += 2;
+
+			return;
+		}
+	}
+
+	if(zigzag < 0x7F) // If the delta fits in the token.
+	{
+		token[0] = 0x80 + zigzag;
+		token_length = 1;
+	}
+	else
+	{
+		token[0] = 0xFF;
+		token[1] = zigzag >> 8;
+		token[2] = zigzag;
+		token_length = 3;
+	}
+
+	previous = current;
+	delta = d;
+	next++;
+}
+
+size_t DeltaFrameFile::read(char* buffer, size_t length)
+{
+	size_t read = 0;
+
+	while(read < length)
+	{
+		if(token_ptr == token_length) // If the whole token has been read.
+		{
+			if(next == samples) // If the whole frame has been encoded.
+			{
+				break;
+			}
+
+			encode(); // Encode the next token.
+		}
+
+		buffer[read++] = token[token_ptr++];
+	}
+
+	_cursor += read;
+
+	return read;
+}
+
+void DeltaFrameFile::cursor(size_t position)
+{
+	char byte;
+
+	rewind(); // Tokens cannot be decoded backward.
+
+	// Encode again up to the position.
+	while(_cursor < position && read(&byte, 1));
+}
@@ -0,0 +1,118 @@
+/* delta_frame_file.h - Implements a compressed file over a shared sample frame
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DELTA_FRAME_FILE_H_
+#define DELTA_FRAME_FILE_H_
+
+#include "frame_file.h"
+
+/**
+ * A read-only file that encodes a sample frame as it gets read, so nothing
+ * more than a token is buffered. Samples are coded as zig-zag deltas from the
+ * previous sample and repeated deltas are run-length coded.
+ *
+ * The file starts with the first sample on two bytes, most significant byte
+ * first, followed by tokens:
+ * - 0x00 to 0x3F: two deltas whose zig-zag values are below 8, the first one
+ *   in bits 3 to 5.
+ * - 0x40 to 0x7F: the previous delta repeated (token & 0x3F) + 1 times. The
+ *   previous delta of the first sample is 0.
+ * - 0x80 to 0xFE: a delta whose zig-zag value is token - 0x80.
+ * - 0xFF: a delta whose zig-zag value is in the next two bytes, most
+ *   significant byte first.
+ * */
+class DeltaFrameFile: public FrameFile
+{
+	protected:
+
+		/// If samples are packed in groups of 4 in 5 bytes.
+		bool wide;
+
+		/// The number of samples in the frame.
+		uint16_t samples;
+
+		/// The index of the next sample to encode.
+		uint16_t next;
+
+		/// The value of the last sample encoded.
+		uint16_t previous;
+
+		/// The last delta encoded.
+		int16_t delta;
+
+		/// The token that was encoded but not read yet.
+		uint8_t token[3];
+
+		/// The length of the token.
+		uint8_t token_length;
+
+		/// The number of bytes of the token already read.
+		uint8_t token_ptr;
+
+	public:
+
+		/**
+		 * Class constructor. The reference to the frame must already have been
+		 * counted by the caller, it is released when the file is deleted.
+		 * @param data the frame's data.
+		 * @param length the length of the frame in bytes.
+		 * @param start the position of the oldest sample in the frame.
+		 * @param references the reference count of the frame.
+		 * @param wide if samples are packed 4 in 5 bytes.
+		 * */
+		DeltaFrameFile(const uint8_t* data, size_t length, size_t start,
+			volatile uint8_t* references, bool wide);
+
+		/**
+		 * Read encoded data from the frame.
+		 * @param buffer the buffer to read into.
+		 * @param length the number of bytes to read.
+		 * @return the number of bytes read.
+		 * */
+		virtual size_t read(char* buffer, size_t length);
+
+		using File::cursor;
+
+		/**
+		 * Move the cursor, the frame is encoded again up to that position.
+		 * @param position the new position of the cursor.
+		 * */
+		virtual void cursor(size_t position);
+
+	protected:
+
+		/**
+		 * @param index the index of a sample from the oldest one.
+		 * @return the value of the sample.
+		 * */
+		uint16_t sample(uint16_t index);
+
+		/// Encode the next token.
+		void encode(void);
+
+		/// Restart encoding from the first sample.
+		void rewind(void);
+};
+
+/// The compressed frame files in their pool, one per channel as well.
+#define DELTA_FRAME_FILE_POOL_COUNT FRAME_FILE_POOL_COUNT
+
+/// Compressed frame files taken from a pool, see Pooled.
+typedef Pooled<DeltaFrameFile, DELTA_FRAME_FILE_POOL_COUNT>
+	PooledDeltaFrameFile;
+
+#endif /* DELTA_FRAME_FILE_H_ */
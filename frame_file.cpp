@@ -0,0 +1,99 @@
+/* frame_file.cpp - Implements a read-only file over a shared sample frame
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "frame_file.h"
+#include <string.h>
+
+FrameFile::FrameFile(const uint8_t* data, size_t length, size_t start,
+	volatile uint8_t* references, size_t count):
+	File(),
+	data(data),
+	start(start),
+	frame_length(length),
+	references(references)
+{
+	size = count ? count: length;
+}
+
+FrameFile::~FrameFile(void)
+{
+	/* The channel's ISR only reads the count, so decrementing it does
+	 * not need to be atomic. Once it reaches 0, the frame can be reused. */
+	(*references)--;
+}
+
+size_t FrameFile::read(char* buffer, size_t length)
+{
+	// If there is not enough data left for the requested length.
+	if(_cursor + length > size)
+	{
+		length = size - _cursor; // Only read what is left.
+	}
+
+	// The position in the buffer of the data at the cursor.
+	size_t position = _cursor + start;
+
+	if(position >= frame_length) // If the frame has wrapped around there.
+	{
+		position -= frame_length;
+	}
+
+	// The length of the data up to the end of the buffer.
+	size_t first = frame_length - position;
+
+	if(first > length) // If the data does not wrap around.
+	{
+		first = length;
+	}
+
+	memcpy(buffer, data + position, first); // Copy up to the end of the buffer.
+	memcpy(buffer + first, data, length - first); // Copy what wrapped around.
+
+	_cursor += length; // Move the cursor forward.
+
+	return length;
+}
+
+size_t FrameFile::write(const char* buffer, size_t length)
+{
+	return 0; // Frames are read-only.
+}
+
+uint16_t FrameFile::unpack(const uint8_t* data, size_t length, size_t start,
+	uint16_t index, bool wide)
+{
+	if(!wide) // If samples are a byte each.
+	{
+		size_t position = start + index;
+
+		// If the frame has wrapped around at that position.
+		return data[position >= length ? position - length: position];
+	}
+
+	// The position of the group of 4 samples.
+	size_t position = start + index / 4 * 5;
+
+	if(position >= length) // If the frame has wrapped around at that position.
+	{
+		position -= length;
+	}
+
+	uint8_t slot = index & 3; // The position of the sample in the group.
+
+	// Reassemble the most significant and the least significant bits.
+	return (data[position + slot] << 2) | ((data[position + 4] >> (slot * 2)) & 3);
+}
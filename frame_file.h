@@ -0,0 +1,101 @@
+/* frame_file.h - Implements a read-only file over a shared sample frame
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FRAME_FILE_H_
+#define FRAME_FILE_H_
+
+#include <utils/file.h>
+#include "pool.h"
+
+/**
+ * A read-only file that gives access to a sample frame owned by a channel
+ * without copying it. Frames are acquired in a circular buffer, the file
+ * rotates them so they read from their oldest sample. Many of these files
+ * can point to the same frame, each with its own cursor; the frame keeps a
+ * count of the files referencing it so the channel does not reuse its
+ * buffer while it is being sent.
+ * */
+class FrameFile: public File
+{
+	protected:
+
+		/// The frame's data.
+		const uint8_t* data;
+
+		/// The position of the oldest sample in the frame.
+		size_t start;
+
+		/// The length of the frame in bytes.
+		size_t frame_length;
+
+		/// The reference count of the frame, decremented when the file is deleted.
+		volatile uint8_t* references;
+
+	public:
+
+		/**
+		 * Class constructor. The reference to the frame must already have been
+		 * counted by the caller, it is released when the file is deleted.
+		 * @param data the frame's data.
+		 * @param length the length of the frame in bytes.
+		 * @param start the position of the oldest sample in the frame.
+		 * @param references the reference count of the frame.
+		 * @param count the number of bytes to read from the start, the whole
+		 * frame if 0.
+		 * */
+		FrameFile(const uint8_t* data, size_t length, size_t start,
+			volatile uint8_t* references, size_t count = 0);
+
+		/// Class destructor.
+		virtual ~FrameFile(void);
+
+		/**
+		 * Read data from the frame.
+		 * @param buffer the buffer to read into.
+		 * @param length the number of bytes to read.
+		 * @return the number of bytes read.
+		 * */
+		virtual size_t read(char* buffer, size_t length);
+
+		/**
+		 * Frames are read-only, nothing gets written.
+		 * @return 0.
+		 * */
+		virtual size_t write(const char* buffer, size_t length);
+
+		/**
+		 * Read a sample from a frame.
+		 * @param data the frame's data.
+		 * @param length the length of the frame in bytes.
+		 * @param start the position of the oldest sample in the frame.
+		 * @param index the index of the sample from the oldest one.
+		 * @param wide if samples are packed 4 in 5 bytes.
+		 * @return the value of the sample.
+		 * */
+		static uint16_t unpack(const uint8_t* data, size_t length, size_t start,
+			uint16_t index, bool wide);
+};
+
+/** The frame files in their pool. The page polls a frame of each channel at
+ * a time and /all sends a frame of each channel, so there is one per
+ * channel. */
+#define FRAME_FILE_POOL_COUNT 2
+
+/// Frame files taken from a pool, see Pooled.
+typedef Pooled<FrameFile, FRAME_FILE_POOL_COUNT> PooledFrameFile;
+
+#endif /* FRAME_FILE_H_ */
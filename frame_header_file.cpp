@@ -0,0 +1,86 @@
+/* frame_header_file.cpp - Implements a file prepending metadata to a frame
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "frame_header_file.h"
+#include <string.h>
+#include <stdlib.h>
+
+FrameHeaderFile::FrameHeaderFile(File* frame, const frame_header_t& header):
+	File(),
+	header(header),
+	frame(frame)
+{
+	size = sizeof(frame_header_t) + frame->size;
+}
+
+FrameHeaderFile::~FrameHeaderFile(void)
+{
+	delete frame; // Release the frame.
+}
+
+const char* FrameHeaderFile::entity_tag(void)
+{
+	etag[0] = '"';
+	utoa(header.sequence, etag + 1, 10);
+	strcat(etag, "\"");
+
+	return etag;
+}
+
+size_t FrameHeaderFile::read(char* buffer, size_t length)
+{
+	size_t read = 0;
+
+	if(_cursor < sizeof(frame_header_t)) // If the header is being read.
+	{
+		read = sizeof(frame_header_t) - _cursor;
+
+		if(read > length)
+		{
+			read = length;
+		}
+
+		// The header is sent as it is laid out in memory.
+		memcpy(buffer, (const uint8_t*)&header + _cursor, read);
+
+		_cursor += read;
+	}
+
+	if(read < length) // If there is room left for the frame.
+	{
+		size_t left = frame->read(buffer + read, length - read);
+
+		read += left;
+		_cursor += left;
+	}
+
+	return read;
+}
+
+size_t FrameHeaderFile::write(const char* buffer, size_t length)
+{
+	return 0; // Frames are read-only.
+}
+
+void FrameHeaderFile::cursor(size_t position)
+{
+	_cursor = position;
+
+	// Position the frame where the header ends.
+	frame->cursor(position > sizeof(frame_header_t) ?
+		position - sizeof(frame_header_t): 0);
+}
@@ -0,0 +1,160 @@
+/* frame_header_file.h - Implements a file prepending metadata to a frame
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FRAME_HEADER_FILE_H_
+#define FRAME_HEADER_FILE_H_
+
+#include <utils/file.h>
+#include <core/resource.h>
+#include "pool.h"
+
+/// The version of the frame header format.
+#define FRAME_HEADER_VERSION 3
+
+/// The frame is compressed (see DeltaFrameFile).
+#define FRAME_COMPRESSED _BV(0)
+
+/// The frame holds pairs of peaks.
+#define FRAME_PEAKS _BV(1)
+
+/// The frame is the average of many.
+#define FRAME_AVERAGED _BV(2)
+
+/// The frame is a composite of interleaved frames.
+#define FRAME_INTERLEAVED _BV(3)
+
+/** The frame holds the samples acquired in roll mode since a given index,
+ * the sequence number is the index of the first one. */
+#define FRAME_ROLL _BV(4)
+
+/** The frame holds the bins of the spectrum of a frame (see SpectrumFile),
+ * the record length is their number. */
+#define FRAME_SPECTRUM _BV(5)
+
+/// The frame is a segment, the sequence number is its index.
+#define FRAME_SEGMENT _BV(6)
+
+/// The trigger index of a frame that was not triggered.
+#define NO_TRIGGER 0xFF
+
+/**
+ * The metadata sent before a frame, in the order it is sent. Multi-byte
+ * fields are little-endian.
+ * */
+struct frame_header_t
+{
+	/// FRAME_HEADER_VERSION.
+	uint8_t version;
+
+	/// The number of the channel, starting from 1.
+	uint8_t channel;
+
+	/// FRAME_COMPRESSED, FRAME_PEAKS, FRAME_AVERAGED, FRAME_INTERLEAVED,
+	/// FRAME_ROLL, FRAME_SPECTRUM and FRAME_SEGMENT.
+	uint8_t flags;
+
+	/// The number of bits per sample, 8 or 10.
+	uint8_t resolution;
+
+	/// The sequence number of the frame.
+	uint16_t sequence;
+
+	/// The uptime in ms when the frame was completed.
+	uint32_t timestamp;
+
+	/** The number of samples per second in the frame in millihertz, so
+	 * decimated rates under 1 Hz are not truncated. */
+	uint32_t rate;
+
+	/// The number of samples in the frame.
+	uint8_t record_length;
+
+	/// The index of the sample at the trigger, NO_TRIGGER if there is none.
+	uint8_t trigger;
+
+	/// The number of frames dropped by the channel since it started.
+	uint16_t dropped;
+} __attribute__((packed));
+
+/**
+ * A read-only file that sends the metadata of a frame before the frame
+ * itself, which is read from its own file without being copied.
+ * */
+class FrameHeaderFile: public File
+{
+	protected:
+
+		/// The metadata of the frame.
+		frame_header_t header;
+
+		/// The frame, deleted with the file.
+		File* frame;
+
+		/** The entity tag of the frame, kept with the file so it lives as long
+		 * as the response it is added to. */
+		char etag[8];
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param frame the file of the frame, it is deleted with this file.
+		 * @param header the metadata of the frame.
+		 * */
+		FrameHeaderFile(File* frame, const frame_header_t& header);
+
+		/// Class destructor.
+		virtual ~FrameHeaderFile(void);
+
+		/**
+		 * @return the entity tag of the frame, its sequence number as a
+		 * quoted string.
+		 * */
+		const char* entity_tag(void);
+
+		/**
+		 * Read the metadata then the frame.
+		 * @param buffer the buffer to read into.
+		 * @param length the number of bytes to read.
+		 * @return the number of bytes read.
+		 * */
+		virtual size_t read(char* buffer, size_t length);
+
+		/**
+		 * Frames are read-only, nothing gets written.
+		 * @return 0.
+		 * */
+		virtual size_t write(const char* buffer, size_t length);
+
+		using File::cursor;
+
+		/**
+		 * Move the cursor.
+		 * @param position the new position of the cursor.
+		 * */
+		virtual void cursor(size_t position);
+};
+
+/** The frame header files in their pool, one per frame of each channel,
+ * segments and spectra included. */
+#define FRAME_HEADER_FILE_POOL_COUNT 2
+
+/// Frame header files taken from a pool, see Pooled.
+typedef Pooled<FrameHeaderFile, FRAME_HEADER_FILE_POOL_COUNT>
+	PooledFrameHeaderFile;
+
+#endif /* FRAME_HEADER_FILE_H_ */
@@ -0,0 +1,330 @@
+/* bench.cpp - Benchmark the acquisition kernels on the host
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "feeder.h"
+#include "../channel.h"
+#include <avr/interrupt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __AVR__ // Built for the MCU, see the avr target of the Makefile.
+#include <avr/sleep.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+/* On the MCU, the cycles are counted by timer 1 running at the CPU clock
+ * and compared with the time a conversion takes at the ADC prescalers the
+ * channels could use. On the host, they are the host's and only compare the
+ * kernels with each other. */
+
+#ifdef __AVR__
+
+/// The number of conversions timed for each configuration.
+#define CONVERSIONS 4096UL
+
+/// The number of samples in the table fed to the channel, a power of two.
+#define TABLE_LENGTH 64
+
+/// The number of conversions in a period of the sine fed to the channel.
+#define PERIOD 32
+
+/// A count of cycles, timer 1 is 16 bits.
+typedef uint16_t counter_t;
+
+/// The interrupt is called like a function to time it, as on the host.
+extern "C" void ADC_vect(void) __attribute__((signal));
+
+#else
+
+#define CONVERSIONS 2000000UL ///< See the MCU's.
+#define TABLE_LENGTH 4096 ///< See the MCU's.
+#define PERIOD 50 ///< See the MCU's.
+
+/// A count of cycles.
+typedef uint64_t counter_t;
+
+#endif
+
+/// The conversions timed in a row, few enough for timer 1 not to wrap around.
+#define BATCH 64
+
+/// The ADC clocks a conversion takes once started by the timer.
+#define CONVERSION_CLOCKS 13
+
+/// A channel whose resources can be requested from the host.
+class HostChannel: public Channel
+{
+	public:
+
+		HostChannel(uint8_t number): Channel(number) {}
+
+		/**
+		 * Change the parameters of the channel.
+		 * @param args the parameters, as in the body of a POST to /pr.
+		 * @return the status of the response.
+		 * */
+		Response::status_code post(const char* args)
+		{
+			Request request(Request::POST, "ch/pr", args);
+			Response response(OK_200, &request);
+
+			return process(&request, &response);
+		}
+};
+
+#ifdef __AVR__
+
+/// Have timer 1 count the CPU cycles, the channels trigger conversions with it.
+static void start_counter(void)
+{
+	TCCR1A = 0;
+	TCCR1B = _BV(CS10);
+	TIMSK1 = 0;
+
+	// Conversions are completed by calling the interrupt, not by the ADC.
+	ADCSRA &= ~_BV(ADIE);
+}
+
+/// @return the count of timer 1.
+static counter_t cycles(void)
+{
+	return TCNT1;
+}
+
+/**
+ * Send a character of the report on the serial port, the simulator prints it.
+ * @param c the character.
+ * @param stream the serial port.
+ * @return 0.
+ * */
+static int put(char c, FILE* stream)
+{
+	loop_until_bit_is_set(UCSR0A, UDRE0);
+	UDR0 = c;
+
+	return 0;
+}
+
+/// The serial port the report is printed on.
+static FILE serial;
+
+#else
+
+/// Nothing to set up on the host.
+static void start_counter(void) {}
+
+/// @return a count of the host's cycles, or nanoseconds without a counter.
+static counter_t cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+#endif
+
+/// The samples fed to the channel.
+static uint16_t table[TABLE_LENGTH];
+
+/// Where the loop timed alone puts the samples, so it is not optimized away.
+static volatile uint16_t sink;
+
+/**
+ * Time conversions fed from the table, in batches.
+ * @param channel the channel, NULL to time the loop around the conversions.
+ * @param isr if the whole interrupt is timed rather than the kernel alone.
+ * @return the cycles per conversion in tenths.
+ * */
+static uint32_t time_conversions(HostChannel* channel, bool isr)
+{
+	uint64_t total = 0;
+
+	for(uint32_t i = 0; i < CONVERSIONS; i += BATCH)
+	{
+		counter_t start = cycles();
+
+		for(uint8_t j = 0; j < BATCH; j++)
+		{
+			uint16_t sample = table[(i + j) & (TABLE_LENGTH - 1)];
+
+			if(!channel)
+			{
+				sink = sample;
+			}
+			else if(isr)
+			{
+				/* The data register is read-only on the MCU, so there the
+				 * interrupt stores whatever the ADC converted last. */
+				ADCW = sample;
+				ADC_vect();
+			}
+			else
+			{
+				channel->store_sample(sample);
+			}
+		}
+
+		total += (counter_t)(cycles() - start);
+	}
+
+	return total * 10 / CONVERSIONS;
+}
+
+/**
+ * Print cycles per conversion.
+ * @param tenths the cycles in tenths.
+ * */
+static void print_cycles(int32_t tenths)
+{
+	char text[16];
+
+	// There is no floating point printf on the MCU.
+	sprintf(text, "%s%ld.%ld", tenths < 0 ? "-": "", labs(tenths) / 10,
+		labs(tenths) % 10);
+
+	printf(" %10s", text);
+}
+
+/**
+ * Time the kernel of a channel on its own and with the interrupt around it.
+ * @param channel the channel, the only one converted.
+ * @param name the name of the configuration.
+ * @param loop the cycles of the loop around each conversion in tenths.
+ * */
+static void measure(HostChannel& channel, const char* name, uint32_t loop)
+{
+	// Get the triggers armed and the frames going first.
+	for(uint32_t i = 0; i < TABLE_LENGTH; i++)
+	{
+		channel.store_sample(table[i]);
+	}
+
+	int32_t kernel = time_conversions(&channel, false) - loop;
+	int32_t isr = time_conversions(&channel, true) - loop;
+
+	printf("%-24s", name);
+	print_cycles(kernel);
+	print_cycles(isr);
+
+#ifdef __AVR__
+	// The cycles left between conversions at ADC prescalers 16 and 32.
+	print_cycles(CONVERSION_CLOCKS * 16 * 10 - isr);
+	print_cycles(CONVERSION_CLOCKS * 32 * 10 - isr);
+#endif
+
+	printf("\n");
+}
+
+int main(void)
+{
+#ifdef __AVR__
+	UCSR0B = _BV(TXEN0);
+	fdev_setup_stream(&serial, put, NULL, _FDEV_SETUP_WRITE);
+	stdout = &serial;
+#endif
+
+	// The channels register themselves, the last one starts the scan.
+	HostChannel* channels[NUMBER_OF_CHANNELS];
+
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		channels[i] = new HostChannel(i + 1);
+	}
+
+	// Only convert the first channel, so the interrupt always stores into it.
+	for(uint8_t i = 1; i < NUMBER_OF_CHANNELS; i++)
+	{
+		channels[i]->post("en=0");
+	}
+
+	HostChannel& channel = *channels[0];
+
+	// A sine fed over and over, the triggers fire every period.
+	Feeder feeder(WAVE_SINE, PERIOD);
+
+	for(uint16_t i = 0; i < TABLE_LENGTH; i++)
+	{
+		table[i] = feeder.sample();
+	}
+
+	/* The parameters of each configuration, the trigger modes at both
+	 * resolutions then the other acquisition modes. */
+	static const char* const configurations[][2] =
+	{
+		{ "trigger off, 8 bits", "rs=8&am=0&tf=0" },
+		{ "trigger up, 8 bits", "rs=8&am=0&tf=3&tl=128" },
+		{ "trigger down, 8 bits", "rs=8&am=0&tf=1&tl=128" },
+		{ "trigger off, 10 bits", "rs=10&am=0&tf=0" },
+		{ "trigger up, 10 bits", "rs=10&am=0&tf=3&tl=512" },
+		{ "trigger down, 10 bits", "rs=10&am=0&tf=1&tl=512" },
+		{ "peak detect, 8 bits", "rs=8&am=1&tf=0&dc=8" },
+		{ "roll, 8 bits", "rs=8&am=2&tf=0" },
+		{ "segments, trigger up", "rs=8&am=0&tf=3&tl=128&sg=16" }
+	};
+
+	start_counter();
+
+	// The cycles of the loop are taken out of those of the conversions.
+	uint32_t loop = time_conversions(NULL, false);
+
+#ifdef __AVR__
+	printf("%-24s %10s %10s %10s %10s\n", "configuration", "cycles",
+		"isr cycles", "left /16", "left /32");
+#else
+	printf("%-24s %10s %10s\n", "configuration", "cycles",
+		"isr cycles");
+#endif
+
+	for(uint8_t i = 0; i < sizeof(configurations) / sizeof(*configurations);
+		i++)
+	{
+		if(channel.post(configurations[i][1]) != OK_200)
+		{
+			printf("%-24s rejected\n", configurations[i][0]);
+			continue;
+		}
+
+		start_counter(); // Posting the parameters restarts the timer.
+
+		measure(channel, configurations[i][0], loop);
+
+		channel.post("sg=0"); // Give the memory of the segments back.
+	}
+
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		delete channels[i];
+	}
+
+#ifdef __AVR__
+	// The simulator quits once the MCU sleeps with the interrupts disabled.
+	cli();
+	sleep_enable();
+	sleep_cpu();
+#endif
+
+	return 0;
+}
@@ -0,0 +1,73 @@
+/* feeder.cpp - Feed synthetic conversions to the ADC interrupt on the host
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "feeder.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <math.h>
+
+Feeder::Feeder(uint8_t wave, uint16_t period, uint16_t amplitude):
+	wave(wave),
+	period(period ? period: 1),
+	amplitude(amplitude > 1023 ? 1023: amplitude),
+	phase(0),
+	seed(1)
+{
+
+}
+
+uint16_t Feeder::sample(void)
+{
+	// The position in the period, from -1 to 1.
+	double x = 2.0 * phase / period - 1;
+	double y;
+
+	if(++phase == period)
+	{
+		phase = 0;
+	}
+
+	switch(wave)
+	{
+		case WAVE_SQUARE:
+			y = x < 0 ? -1: 1;
+			break;
+		case WAVE_TRIANGLE:
+			y = 1 - 2 * fabs(x);
+			break;
+		case WAVE_NOISE:
+			seed = seed * 1103515245 + 12345;
+			y = (int32_t)(seed >> 16 & 0x7FFF) / 16383.5 - 1;
+			break;
+		default:
+			y = sin(M_PI * x);
+	}
+
+	return (uint16_t)(512 + y * amplitude / 2) & 0x3FF;
+}
+
+void Feeder::convert(uint32_t count)
+{
+	while(count--)
+	{
+		// The result is right adjusted, ADCH also holds it left adjusted.
+		ADCW = sample();
+		ADCH = ADCW >> 2;
+
+		ADC_vect();
+	}
+}
@@ -0,0 +1,73 @@
+/* feeder.h - Feed synthetic conversions to the ADC interrupt on the host
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FEEDER_H_
+#define FEEDER_H_
+
+#include <stdint.h>
+
+/// The waveforms a feeder converts.
+#define WAVE_SINE 0
+#define WAVE_SQUARE 1 ///< See WAVE_SINE.
+#define WAVE_TRIANGLE 2 ///< See WAVE_SINE.
+#define WAVE_NOISE 3 ///< See WAVE_SINE.
+
+/**
+ * Stands for the input of the ADC on the host. Each conversion puts the
+ * next sample of a waveform in the data registers and calls the ADC's
+ * interrupt service routine, like a completed conversion would.
+ * */
+class Feeder
+{
+	protected:
+
+		/// The waveform.
+		uint8_t wave;
+
+		/// The number of conversions in a period of the waveform.
+		uint16_t period;
+
+		/// The peak to peak amplitude, in 10 bits steps.
+		uint16_t amplitude;
+
+		/// The position in the period of the next conversion.
+		uint16_t phase;
+
+		/// The state of the noise generator.
+		uint32_t seed;
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param wave the waveform.
+		 * @param period the number of conversions in a period.
+		 * @param amplitude the peak to peak amplitude, up to 1023.
+		 * */
+		Feeder(uint8_t wave, uint16_t period, uint16_t amplitude = 1023);
+
+		/// @return the next sample of the waveform, centered on 512.
+		uint16_t sample(void);
+
+		/**
+		 * Complete conversions.
+		 * @param count the number of conversions.
+		 * */
+		void convert(uint32_t count);
+};
+
+#endif /* FEEDER_H_ */
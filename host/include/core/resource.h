@@ -0,0 +1,314 @@
+/* resource.h - Host stand-in for the resources of the framework
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOST_CORE_RESOURCE_H_
+#define HOST_CORE_RESOURCE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+#include <utils/file.h>
+
+/* Only what the oscilloscope uses of the framework is declared here, with
+ * the same names and semantics, see host/stubs.cpp for the definitions. */
+
+/// The uptime in milliseconds.
+typedef uint32_t uptime_t;
+
+/// A schedule that never comes.
+#define NEVER ((uptime_t)-1)
+
+/// @return the uptime, set with set_uptime() on the host.
+uptime_t get_uptime(void);
+
+/// Set the uptime returned by get_uptime().
+void set_uptime(uptime_t uptime);
+
+/// Allocate memory, there are no interrupts to disable on the host.
+void* ts_malloc(size_t size);
+
+/// Free memory allocated with ts_malloc().
+void ts_free(void* pointer);
+
+/// Run a block of code with the interrupts disabled, once.
+#define ATOMIC for(uint8_t _atomic = 1; _atomic; _atomic = 0)
+
+#define VERBOSE_PRINT_P(string)
+#define VERBOSE_PRINTLN_P(string)
+
+#ifndef __AVR__ // avr-libc has them.
+extern "C" char* utoa(unsigned int value, char* string, int radix);
+extern "C" char* ultoa(unsigned long value, char* string, int radix);
+#endif
+
+/**
+ * A first in first out queue of a fixed number of items.
+ * @param T the type of the items, a pointer.
+ * @param capacity the number of items it holds.
+ * */
+template<class T, uint8_t capacity = 8> class Queue
+{
+	protected:
+
+		/// The items, from the head.
+		T data[capacity];
+
+		/// The index of the head.
+		uint8_t head;
+
+	public:
+
+		/// The number of items in the queue.
+		uint8_t items;
+
+		Queue(void): head(0), items(0) {}
+
+		/**
+		 * Add an item at the end of the queue.
+		 * @param item the item.
+		 * @return 0 if the item was added, 1 if the queue is full.
+		 * */
+		uint8_t queue(T item)
+		{
+			if(items == capacity)
+			{
+				return 1;
+			}
+
+			data[(head + items++) % capacity] = item;
+
+			return 0;
+		}
+
+		/// @return the item removed from the head, NULL if there is none.
+		T dequeue(void)
+		{
+			if(!items)
+			{
+				return NULL;
+			}
+
+			T item = data[head];
+			head = (head + 1) % capacity;
+			items--;
+
+			return item;
+		}
+
+		/// @return the item at the head, NULL if there is none.
+		T peek(void)
+		{
+			return items ? data[head]: NULL;
+		}
+};
+
+/// The content types of the bodies.
+namespace MIME
+{
+	enum Type
+	{
+		TEXT_HTML,
+		TEXT_CSS,
+		APPLICATION_JAVASCRIPT,
+		APPLICATION_JSON,
+		APPLICATION_XHTML_XML,
+		APPLICATION_OCTET_STREAM
+	};
+}
+
+/// A request or a response.
+class Message
+{
+	public:
+
+		/// The uptime when the message was created.
+		uptime_t age;
+
+		/// The body of the message, deleted with it.
+		File* body_file;
+
+		/// The content type of the body.
+		MIME::Type mime;
+
+		Message(void);
+
+		virtual ~Message(void);
+
+		/**
+		 * Set the body of the message.
+		 * @param file the body, deleted with the message.
+		 * @param type the content type of the body.
+		 * */
+		void set_body(File* file, MIME::Type type);
+};
+
+/**
+ * A request for a resource. Its url is split into the names of the
+ * resources, the current one being the resource processing it.
+ * */
+class Request: public Message
+{
+	public:
+
+		/// The methods of a request.
+		enum method_t { GET, POST };
+
+	protected:
+
+		/// The method.
+		method_t method;
+
+		/// The names of the resources of the url.
+		char* resources[8];
+
+		/// The number of names in the url.
+		uint8_t depth;
+
+		/// The index of the current resource.
+		uint8_t index;
+
+		/// The arguments, as in a query string.
+		char* args;
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param method the method.
+		 * @param url the names of the resources separated by /, without the
+		 * leading one.
+		 * @param args the arguments as in a query string, such as "a=1&b=2".
+		 * */
+		Request(method_t method, const char* url, const char* args = "");
+
+		virtual ~Request(void);
+
+		/// @return the number of resources left until the destination.
+		uint8_t to_destination(void);
+
+		/// Go to the next resource of the url.
+		void next(void);
+
+		/// Go back to the previous resource of the url.
+		void previous(void);
+
+		/// @return the name of the current resource.
+		const char* current(void);
+
+		/**
+		 * Find an argument.
+		 * @param key the name of the argument.
+		 * @param buffer the buffer to copy its value to, not terminated.
+		 * @param length the most characters copied.
+		 * @return the number of characters copied, 0 if it was not found.
+		 * */
+		uint8_t find_arg(const char* key, char* buffer, uint8_t length);
+
+		/// There are no headers on the host, see find_arg().
+		uint8_t find_header(const char* key, char* buffer, uint8_t length);
+
+		/// @return if the request has that method.
+		bool is_method(method_t method);
+};
+
+/// A response to a request.
+class Response: public Message
+{
+	public:
+
+		/// The status codes used by the oscilloscope.
+		enum status_code
+		{
+			RESPONSE_DELAYED_102 = 102,
+			OK_200 = 200,
+			NOT_MODIFIED_304 = 304,
+			PASS_308 = 308,
+			BAD_REQUEST_400 = 400,
+			NOT_FOUND_404 = 404,
+			REQUEST_TIMEOUT_408 = 408,
+			NOT_IMPLEMENTED_501 = 501,
+			SERVICE_UNAVAILABLE_503 = 503
+		};
+
+		/// The status of the response.
+		status_code response_code_int;
+
+		/// The request answered.
+		Request* request;
+
+		/// The number of headers added.
+		uint8_t headers;
+
+		Response(status_code code, Request* request);
+
+		/// Headers are only counted on the host.
+		int8_t add_header(const char* name, const char* value);
+};
+
+#define RESPONSE_DELAYED_102 Response::RESPONSE_DELAYED_102
+#define OK_200 Response::OK_200
+#define NOT_MODIFIED_304 Response::NOT_MODIFIED_304
+#define PASS_308 Response::PASS_308
+#define BAD_REQUEST_400 Response::BAD_REQUEST_400
+#define NOT_FOUND_404 Response::NOT_FOUND_404
+#define REQUEST_TIMEOUT_408 Response::REQUEST_TIMEOUT_408
+#define NOT_IMPLEMENTED_501 Response::NOT_IMPLEMENTED_501
+#define SERVICE_UNAVAILABLE_503 Response::SERVICE_UNAVAILABLE_503
+
+/**
+ * A resource of the tree. The host does not walk the tree: requests are
+ * given to process() and the responses dispatched later are kept.
+ * */
+class Resource
+{
+	public:
+
+		/// The uptime the resource is scheduled to run at.
+		uptime_t scheduled;
+
+		/// The last response dispatched, deleted with the next one.
+		Response* dispatched;
+
+		Resource(void);
+
+		virtual ~Resource(void);
+
+		/// Children are not kept on the host.
+		int8_t add_child(const char* name, Resource* child);
+
+	protected:
+
+		/// @return PASS_308, there are no children to pass the request to.
+		virtual Response::status_code process(Request* request,
+			Response* response);
+
+		/// Called once the resource is scheduled.
+		virtual void run(void);
+
+		/**
+		 * Schedule the resource.
+		 * @param delay the milliseconds from now, NEVER to unschedule it.
+		 * */
+		void schedule(uptime_t delay);
+
+		/// Keep the response, see dispatched.
+		void dispatch(Message* message);
+};
+
+#endif /* HOST_CORE_RESOURCE_H_ */
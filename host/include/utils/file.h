@@ -0,0 +1,50 @@
+/* file.h - Host stand-in for the File class of the framework
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOST_UTILS_FILE_H_
+#define HOST_UTILS_FILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// A sequence of bytes read from a cursor, the base of every response body.
+class File
+{
+	protected:
+
+		/// The position of the next byte read.
+		size_t _cursor;
+
+	public:
+
+		/// The number of bytes in the file.
+		size_t size;
+
+		File(void): _cursor(0), size(0) {}
+
+		virtual ~File(void) {}
+
+		virtual size_t read(char* buffer, size_t length) = 0;
+
+		virtual size_t write(const char* buffer, size_t length) { return 0; }
+
+		virtual void cursor(size_t position) { _cursor = position; }
+
+		size_t cursor(void) { return _cursor; }
+};
+
+#endif /* HOST_UTILS_FILE_H_ */
@@ -0,0 +1,53 @@
+/* pgmspace_file.h - Host stand-in for the PGMSpaceFile class of the framework
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOST_UTILS_PGMSPACE_FILE_H_
+#define HOST_UTILS_PGMSPACE_FILE_H_
+
+#include <utils/file.h>
+#include <avr/pgmspace.h>
+
+/// A read-only file over a string in program memory.
+class PGMSpaceFile: public File
+{
+	protected:
+
+		/// The string.
+		const char* data;
+
+	public:
+
+		PGMSpaceFile(const char* data, size_t length): File(), data(data)
+		{
+			size = length;
+		}
+
+		virtual size_t read(char* buffer, size_t length)
+		{
+			if(_cursor + length > size)
+			{
+				length = size - _cursor;
+			}
+
+			memcpy_P(buffer, data + _cursor, length);
+			_cursor += length;
+
+			return length;
+		}
+};
+
+#endif /* HOST_UTILS_PGMSPACE_FILE_H_ */
@@ -0,0 +1,65 @@
+/* template.h - Host stand-in for the Template class of the framework
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOST_UTILS_TEMPLATE_H_
+#define HOST_UTILS_TEMPLATE_H_
+
+#include <utils/file.h>
+
+/// The most arguments a template takes.
+#define TEMPLATE_ARGS 16
+
+/**
+ * A file replacing each ~ of another file by the next argument. The text
+ * is generated in full when it is first read, unlike the framework's.
+ * */
+class Template: public File
+{
+	protected:
+
+		/// The file holding the template.
+		File* file;
+
+		/// The arguments, in the order they replace the ~.
+		int32_t args[TEMPLATE_ARGS];
+
+		/// The number of arguments.
+		uint8_t count;
+
+		/// The generated text, allocated when it is first read.
+		char* text;
+
+		/// Generate the text.
+		void render(void);
+
+	public:
+
+		Template(File* file);
+
+		virtual ~Template(void);
+
+		virtual size_t read(char* buffer, size_t length);
+
+		/**
+		 * Add a numerical argument.
+		 * @param arg the argument.
+		 * @return 0 if it was added, 1 if there are too many.
+		 * */
+		int8_t add_narg(int32_t arg);
+};
+
+#endif /* HOST_UTILS_TEMPLATE_H_ */
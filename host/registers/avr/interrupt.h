@@ -0,0 +1,32 @@
+/* interrupt.h - Host stand-in for the AVR interrupt declarations
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOST_AVR_INTERRUPT_H_
+#define HOST_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+/// An interrupt handler is a plain function the host can call.
+#define ISR(vector) extern "C" void vector(void)
+
+/// The handler of the ADC conversion complete interrupt, see channel.cpp.
+extern "C" void ADC_vect(void);
+
+#define sei()
+#define cli()
+
+#endif /* HOST_AVR_INTERRUPT_H_ */
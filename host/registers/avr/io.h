@@ -0,0 +1,70 @@
+/* io.h - Host stand-in for the AVR registers used by the oscilloscope
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOST_AVR_IO_H_
+#define HOST_AVR_IO_H_
+
+#include <stdint.h>
+
+/* The registers are plain variables, see host/stubs.cpp. Nothing happens
+ * when they are written: the timer does not count and conversions are only
+ * completed when host/feeder.cpp calls the ISR. */
+
+#define _BV(bit) (1 << (bit))
+
+extern volatile uint8_t ADMUX, ADCH, ADCL, ADCSRA, ADCSRB, DIDR0;
+extern volatile uint16_t ADCW;
+extern volatile uint8_t TCCR1A, TCCR1B, TIMSK1, TIFR1, SREG;
+extern volatile uint16_t TCNT1, OCR1A, OCR1B, ICR1;
+
+// ADMUX
+#define REFS1 7
+#define REFS0 6
+#define ADLAR 5
+
+// ADCSRA
+#define ADEN 7
+#define ADSC 6
+#define ADATE 5
+#define ADIF 4
+#define ADIE 3
+#define ADPS2 2
+#define ADPS1 1
+#define ADPS0 0
+
+// ADCSRB
+#define ADTS2 2
+#define ADTS1 1
+#define ADTS0 0
+
+// DIDR0
+#define ADC0D 0
+
+// TCCR1B
+#define WGM13 4
+#define WGM12 3
+#define CS12 2
+#define CS11 1
+#define CS10 0
+
+// TIFR1 and TIMSK1
+#define OCF1B 2
+#define OCF1A 1
+#define TOV1 0
+#define OCIE1B 2
+
+#endif /* HOST_AVR_IO_H_ */
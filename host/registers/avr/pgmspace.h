@@ -0,0 +1,52 @@
+/* pgmspace.h - Host stand-in for the AVR program memory access
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOST_AVR_PGMSPACE_H_
+#define HOST_AVR_PGMSPACE_H_
+
+#include <string.h>
+#include <stdint.h>
+
+/* Program memory is ordinary memory on the host. */
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+
+#define strcpy_P strcpy
+#define strcmp_P strcmp
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+/**
+ * Read a word from program memory. Tables of pointers are read with it on
+ * AVR, where they are 16 bits, so it reads whatever type is pointed to.
+ * @param address the address of the word.
+ * @return the word.
+ * */
+template<typename T> inline T pgm_read_word(const T* address)
+{
+	return *address;
+}
+
+/// See pgm_read_word().
+template<typename T> inline T pgm_read_byte(const T* address)
+{
+	return *address;
+}
+
+#endif /* HOST_AVR_PGMSPACE_H_ */
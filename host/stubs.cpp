@@ -0,0 +1,363 @@
+/* stubs.cpp - Host definitions of the framework stand-ins
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/resource.h>
+#include <utils/template.h>
+#include <avr/io.h>
+#include <stdio.h>
+
+#ifdef __AVR__ // Built for the MCU, to count its cycles under a simulator.
+
+/// The framework provides these on the MCU, avr-libc does not.
+
+void* operator new(size_t size)
+{
+	return ts_malloc(size);
+}
+
+void operator delete(void* pointer)
+{
+	ts_free(pointer);
+}
+
+extern "C" void __cxa_pure_virtual(void)
+{
+	while(true);
+}
+
+#else
+
+volatile uint8_t ADMUX, ADCH, ADCL, ADCSRA, ADCSRB, DIDR0;
+volatile uint16_t ADCW;
+volatile uint8_t TCCR1A, TCCR1B, TIMSK1, TIFR1, SREG;
+volatile uint16_t TCNT1, OCR1A, OCR1B, ICR1;
+
+/* The heap bounds read by the statistics. The heap is not contiguous on
+ * the host, so they only have to exist. */
+char __heap_start;
+char* __brkval = &__heap_start;
+
+#endif
+
+/// The uptime returned by get_uptime().
+static uptime_t uptime = 0;
+
+uptime_t get_uptime(void)
+{
+	return uptime;
+}
+
+void set_uptime(uptime_t value)
+{
+	uptime = value;
+}
+
+void* ts_malloc(size_t size)
+{
+	return malloc(size);
+}
+
+void ts_free(void* pointer)
+{
+	free(pointer);
+}
+
+#ifndef __AVR__ // avr-libc has them.
+
+char* utoa(unsigned int value, char* string, int radix)
+{
+	return ultoa(value, string, radix);
+}
+
+char* ultoa(unsigned long value, char* string, int radix)
+{
+	char digits[33];
+	uint8_t length = 0;
+
+	do // Write the digits from the lowest.
+	{
+		uint8_t digit = value % radix;
+		digits[length++] = digit < 10 ? '0' + digit: 'a' + digit - 10;
+		value /= radix;
+	}
+	while(value);
+
+	for(uint8_t i = 0; i < length; i++)
+	{
+		string[i] = digits[length - 1 - i];
+	}
+
+	string[length] = '\0';
+
+	return string;
+}
+
+#endif
+
+Template::Template(File* file):
+	File(),
+	file(file),
+	count(0),
+	text(NULL)
+{
+	size = 0;
+}
+
+Template::~Template(void)
+{
+	delete file;
+	free(text);
+}
+
+void Template::render(void)
+{
+	char* source = (char*)malloc(file->size + 1);
+	size_t length = file->read(source, file->size);
+	uint8_t arg = 0;
+
+	source[length] = '\0';
+
+	// Each argument takes at most 11 characters in place of a ~.
+	text = (char*)malloc(length + TEMPLATE_ARGS * 11 + 1);
+	size = 0;
+
+	for(size_t i = 0; i < length; i++)
+	{
+		if(source[i] == '~' && arg < count)
+		{
+			size += sprintf(text + size, "%ld", (long)args[arg++]);
+		}
+		else
+		{
+			text[size++] = source[i];
+		}
+	}
+
+	free(source);
+}
+
+size_t Template::read(char* buffer, size_t length)
+{
+	if(!text)
+	{
+		render();
+	}
+
+	if(_cursor + length > size)
+	{
+		length = size - _cursor;
+	}
+
+	memcpy(buffer, text + _cursor, length);
+	_cursor += length;
+
+	return length;
+}
+
+int8_t Template::add_narg(int32_t arg)
+{
+	if(count == TEMPLATE_ARGS)
+	{
+		return 1;
+	}
+
+	args[count++] = arg;
+
+	return 0;
+}
+
+Message::Message(void):
+	age(get_uptime()),
+	body_file(NULL),
+	mime(MIME::APPLICATION_OCTET_STREAM)
+{
+
+}
+
+Message::~Message(void)
+{
+	delete body_file;
+}
+
+void Message::set_body(File* file, MIME::Type type)
+{
+	delete body_file;
+
+	body_file = file;
+	mime = type;
+}
+
+Request::Request(method_t method, const char* url, const char* args):
+	Message(),
+	method(method),
+	depth(0),
+	index(0),
+	args(strdup(args))
+{
+	char* copy = strdup(url);
+
+	// Split the url into the names of the resources.
+	for(char* name = strtok(copy, "/"); name && depth < 8;
+		name = strtok(NULL, "/"))
+	{
+		resources[depth++] = strdup(name);
+	}
+
+	free(copy);
+}
+
+Request::~Request(void)
+{
+	for(uint8_t i = 0; i < depth; i++)
+	{
+		free(resources[i]);
+	}
+
+	free(args);
+}
+
+uint8_t Request::to_destination(void)
+{
+	return depth - 1 - index;
+}
+
+void Request::next(void)
+{
+	if(index + 1 < depth)
+	{
+		index++;
+	}
+}
+
+void Request::previous(void)
+{
+	if(index)
+	{
+		index--;
+	}
+}
+
+const char* Request::current(void)
+{
+	return resources[index];
+}
+
+uint8_t Request::find_arg(const char* key, char* buffer, uint8_t length)
+{
+	size_t key_length = strlen(key);
+
+	for(const char* arg = args; *arg; )
+	{
+		const char* end = strchr(arg, '&');
+
+		if(!end)
+		{
+			end = arg + strlen(arg);
+		}
+
+		// If this is the argument, copy its value.
+		if(!strncmp(arg, key, key_length) && arg[key_length] == '=')
+		{
+			const char* value = arg + key_length + 1;
+			uint8_t copied = 0;
+
+			for(; value + copied < end && copied < length; copied++)
+			{
+				buffer[copied] = value[copied];
+			}
+
+			return copied;
+		}
+
+		arg = *end ? end + 1: end;
+	}
+
+	return 0;
+}
+
+uint8_t Request::find_header(const char* key, char* buffer, uint8_t length)
+{
+	return 0;
+}
+
+bool Request::is_method(method_t method)
+{
+	return this->method == method;
+}
+
+Response::Response(status_code code, Request* request):
+	Message(),
+	response_code_int(code),
+	request(request),
+	headers(0)
+{
+
+}
+
+int8_t Response::add_header(const char* name, const char* value)
+{
+	headers++;
+
+	return 0;
+}
+
+Resource::Resource(void):
+	scheduled(NEVER),
+	dispatched(NULL)
+{
+
+}
+
+Resource::~Resource(void)
+{
+	if(dispatched)
+	{
+		delete dispatched->request;
+		delete dispatched;
+	}
+}
+
+int8_t Resource::add_child(const char* name, Resource* child)
+{
+	return 0;
+}
+
+Response::status_code Resource::process(Request* request, Response* response)
+{
+	return PASS_308;
+}
+
+void Resource::run(void)
+{
+
+}
+
+void Resource::schedule(uptime_t delay)
+{
+	scheduled = delay == NEVER ? NEVER: get_uptime() + delay;
+}
+
+void Resource::dispatch(Message* message)
+{
+	if(dispatched) // The previous response has been looked at by now.
+	{
+		delete dispatched->request;
+		delete dispatched;
+	}
+
+	dispatched = (Response*)message;
+}
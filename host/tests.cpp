@@ -0,0 +1,428 @@
+/* tests.cpp - Regression checks of the acquisition on the host
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "feeder.h"
+#include "../channel.h"
+#include "../frame_header_file.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Each check feeds a waveform to the first channel, the only one converted,
+ * and asserts on what its resources send. A failed check aborts. */
+
+/// The conversions fed before a frame is checked.
+#define CONVERSIONS 20000UL
+
+/// A channel whose resources can be requested from the host.
+class TestChannel: public Channel
+{
+	protected:
+
+		/// The frame kept by hold_frame().
+		uint8_t held;
+
+	public:
+
+		TestChannel(uint8_t number): Channel(number), held(0) {}
+
+		/**
+		 * Change the parameters of the channel.
+		 * @param args the parameters, as in the body of a POST to /pr.
+		 * */
+		void post(const char* args)
+		{
+			Request request(Request::POST, "ch/pr", args);
+			Response response(OK_200, &request);
+			Response::status_code status = process(&request, &response);
+
+			assert(status == OK_200);
+		}
+
+		/**
+		 * Get the frame that is ready.
+		 * @param header the metadata of the frame.
+		 * @param samples the samples of the frame, unpacked.
+		 * */
+		void get_frame(frame_header_t& header, uint16_t* samples)
+		{
+			Request request(Request::GET, "ch");
+			Response response(OK_200, &request);
+			Response::status_code status = process(&request, &response);
+
+			assert(status == OK_200 && response.body_file);
+
+			File* file = response.body_file;
+			uint8_t data[sizeof(frame_header_t) + 320];
+			size_t length = 0;
+			size_t read;
+
+			while((read = file->read((char*)data + length, 64)))
+			{
+				length += read;
+				assert(length <= sizeof(data));
+			}
+
+			memcpy(&header, data, sizeof(frame_header_t));
+
+			const uint8_t* frame = data + sizeof(frame_header_t);
+
+			for(uint8_t i = 0; i < header.record_length; i++)
+			{
+				if(header.resolution == 10) // If samples are packed.
+				{
+					const uint8_t* group = frame + i / 4 * 5;
+
+					samples[i] = group[i % 4] << 2 |
+						(group[4] >> 2 * (i % 4) & 3);
+				}
+				else
+				{
+					samples[i] = frame[i];
+				}
+			}
+
+			assert(length == sizeof(frame_header_t) + (header.resolution == 10 ?
+				header.record_length / 4 * 5: header.record_length));
+		}
+
+		/**
+		 * Get the measurements of the frame that is ready.
+		 * @param json the measurements, as sent.
+		 * @param size the size of the buffer, including the terminator.
+		 * */
+		void get_measurements(char* json, size_t size)
+		{
+			Request request(Request::GET, "ch/ms");
+			Response response(OK_200, &request);
+			Response::status_code status = process(&request, &response);
+
+			assert(status == OK_200 && response.body_file);
+
+			File* file = response.body_file;
+			size_t length = 0;
+			size_t read;
+
+			while((read = file->read(json + length, size - 1 - length)))
+			{
+				length += read;
+			}
+
+			json[length] = '\0';
+		}
+
+		/**
+		 * Queue a request for the spectrum of the frame that is ready, it is
+		 * deleted with the response dispatched to it.
+		 * */
+		void get_spectrum(void)
+		{
+			Request* request = new Request(Request::GET, "ch/fft");
+			Response response(OK_200, request);
+			Response::status_code status = process(request, &response);
+
+			assert(status == RESPONSE_DELAYED_102);
+		}
+
+		/**
+		 * Keep the ready frame as if it was being sent, or release it.
+		 * @param hold if the frame is kept.
+		 * */
+		void hold_frame(bool hold)
+		{
+			ATOMIC
+			{
+				if(hold)
+				{
+					references[!acquiring]++;
+					held = !acquiring;
+				}
+				else
+				{
+					references[held]--;
+				}
+			}
+		}
+
+		/// @return the number of segments filled, as sent by /seg.
+		unsigned long get_segments(void)
+		{
+			Request request(Request::GET, "ch/seg");
+			Response response(OK_200, &request);
+			Response::status_code status = process(&request, &response);
+
+			assert(status == OK_200 && response.body_file);
+
+			char json[32];
+			size_t length = response.body_file->read(json, sizeof(json) - 1);
+
+			json[length] = '\0';
+
+			unsigned long filled;
+			int parsed = sscanf(json, "{\"sg\":%*u,\"n\":%lu}", &filled);
+
+			assert(parsed == 1);
+
+			return filled;
+		}
+
+		/**
+		 * Let a channel freeze the frames of every channel.
+		 * @param number the number of the channel, 0 for none.
+		 * */
+		static void set_leader(uint8_t number) { synchronize(number); }
+
+		/// Run the channel as if it was scheduled.
+		void run_once(void) { run(); }
+
+		/// @return the sampling rate of the channels.
+		static uint16_t get_sampling_rate(void) { return sampling_rate; }
+};
+
+/**
+ * Get a measurement.
+ * @param json the measurements.
+ * @param name the name of the measurement.
+ * @return its value.
+ * */
+static unsigned long measurement(const char* json, const char* name)
+{
+	char key[8];
+	unsigned long value;
+
+	sprintf(key, "\"%s\":", name);
+
+	const char* position = strstr(json, key);
+
+	assert(position);
+
+	int parsed = sscanf(position + strlen(key), "%lu", &value);
+
+	assert(parsed == 1);
+
+	return value;
+}
+
+/**
+ * Check that frames get triggered as requested.
+ * @param channel the channel.
+ * @param resolution 8 or 10 bits.
+ * @param flags the trigger flags.
+ * @param peaks if the peaks of intervals of 8 conversions are kept.
+ * */
+static void check_trigger(TestChannel& channel, uint8_t resolution,
+	uint8_t flags, bool peaks)
+{
+	// The trigger level is in steps of the resolution.
+	uint16_t level = resolution == 10 ? 512: 128;
+	uint8_t decimation = peaks ? 8: 1;
+	char args[64];
+
+	sprintf(args, "rs=%u&am=%u&dc=%u&rl=100&pt=50&tf=%u&tl=%u", resolution,
+		peaks ? 1: 0, decimation, flags, level);
+	channel.post(args);
+
+	Feeder feeder(WAVE_SINE, 97);
+	feeder.convert(CONVERSIONS * decimation);
+
+	frame_header_t header;
+	uint16_t samples[256];
+
+	channel.get_frame(header, samples);
+
+	assert(header.resolution == resolution);
+	assert(header.sequence > 0); // Frames are getting completed.
+
+	if(!(flags & 1)) // If triggering is off.
+	{
+		assert(header.trigger == NO_TRIGGER);
+
+		printf("trigger off, %u bits%s: ok\n", resolution,
+			peaks ? ", peaks": "");
+
+		return;
+	}
+
+	uint8_t t = header.trigger;
+
+	// The slope is followed on the maxima going up and the minima going down.
+	uint8_t step = peaks ? 2: 1;
+
+	// Around the requested position, frames start on a group of samples.
+	assert(t != NO_TRIGGER && t >= 2 * step && t < header.record_length);
+	assert(t + 4 >= header.record_length / 2);
+	assert(t <= header.record_length / 2 + 4);
+
+	if(flags & 2) // If triggering is on the up slope.
+	{
+		assert(!peaks || t % 2 == 1); // Maxima follow minima.
+		assert(samples[t] >= level);
+		assert(samples[t] >= samples[t - step]);
+		assert(samples[t - step] >= samples[t - 2 * step]);
+	}
+	else
+	{
+		assert(!peaks || t % 2 == 0);
+		assert(samples[t] <= level);
+		assert(samples[t] <= samples[t - step]);
+		assert(samples[t - step] <= samples[t - 2 * step]);
+	}
+
+	printf("trigger %s, %u bits%s: ok\n", flags & 2 ? "up": "down",
+		resolution, peaks ? ", peaks": "");
+}
+
+/**
+ * Check that the rate of decimated frames and their measurements hold under
+ * 1 Hz.
+ * @param channel the channel.
+ * */
+static void check_slow_rate(TestChannel& channel)
+{
+	channel.post("sr=1&rs=8&am=0&dc=2&rl=200&tf=0");
+
+	uint16_t rate = TestChannel::get_sampling_rate();
+
+	// The conversions in a period of the signal.
+	Feeder feeder(WAVE_SINE, 40);
+	feeder.convert(CONVERSIONS);
+
+	frame_header_t header;
+	uint16_t samples[256];
+
+	channel.get_frame(header, samples);
+
+	assert(header.rate == (uint32_t)rate * 1000 / 2);
+
+	char json[128];
+
+	channel.get_measurements(json, sizeof(json));
+
+	// Within 10 % of the signal's frequency and period.
+	unsigned long frequency = measurement(json, "fr");
+	unsigned long period = measurement(json, "pd");
+
+	assert(frequency * 40 >= rate * 900UL && frequency * 40 <= rate * 1100UL);
+	assert(period * rate / 40 >= 900000UL && period * rate / 40 <= 1100000UL);
+
+	printf("measurements at %u mHz: ok\n", header.rate);
+}
+
+/**
+ * Check that spectra are only sent from evenly spaced samples, even when
+ * peak detection starts while one is waiting.
+ * @param channel the channel.
+ * */
+static void check_spectrum(TestChannel& channel)
+{
+	channel.post("sr=1000&rs=8&am=0&dc=1&rl=64&tf=0&av=1");
+
+	Feeder feeder(WAVE_SINE, 16);
+	feeder.convert(CONVERSIONS);
+
+	channel.get_spectrum();
+	channel.run_once();
+
+	assert(channel.dispatched &&
+		channel.dispatched->response_code_int == OK_200);
+
+	channel.get_spectrum();
+	channel.post("am=1&dc=8"); // Pairs of peaks are not evenly spaced.
+	feeder.convert(CONVERSIONS);
+	channel.run_once();
+
+	assert(channel.dispatched &&
+		channel.dispatched->response_code_int == SERVICE_UNAVAILABLE_503);
+
+	printf("spectrum in peak detect mode: ok\n");
+}
+
+/**
+ * Check that segments keep being acquired in step when the frames of
+ * synchronized channels are dropped because one of them is still being sent.
+ * @param leader the channel that triggers.
+ * @param follower a channel frozen with it.
+ * */
+static void check_segments(TestChannel& leader, TestChannel& follower)
+{
+	const char* args = "sr=1000&rs=8&am=0&dc=1&rl=64&tf=3&tl=128&sg=4";
+
+	leader.post(args);
+	follower.post("en=1");
+	follower.post(args);
+	TestChannel::set_leader(1);
+
+	follower.hold_frame(true); // Every set completed gets dropped.
+
+	Feeder feeder(WAVE_SINE, 97);
+	feeder.convert(CONVERSIONS);
+
+	follower.hold_frame(false);
+
+	unsigned long filled = leader.get_segments();
+
+	assert(filled == 4);
+
+	filled = follower.get_segments();
+
+	assert(filled == 4);
+
+	TestChannel::set_leader(0);
+	leader.post("sg=0");
+	follower.post("sg=0&en=0");
+
+	printf("segments with dropped frames: ok\n");
+}
+
+int main(void)
+{
+	TestChannel* channels[NUMBER_OF_CHANNELS];
+
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		channels[i] = new TestChannel(i + 1);
+	}
+
+	// Only convert the first channel, so the interrupt always stores into it.
+	for(uint8_t i = 1; i < NUMBER_OF_CHANNELS; i++)
+	{
+		channels[i]->post("en=0");
+	}
+
+	TestChannel& channel = *channels[0];
+
+	for(uint8_t resolution = 8; resolution <= 10; resolution += 2)
+	{
+		for(uint8_t peaks = 0; peaks <= 1; peaks++)
+		{
+			check_trigger(channel, resolution, 0, peaks);
+			check_trigger(channel, resolution, 3, peaks);
+			check_trigger(channel, resolution, 1, peaks);
+		}
+	}
+
+	check_segments(channel, *channels[1]);
+	check_spectrum(channel);
+	check_slow_rate(channel);
+
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		delete channels[i];
+	}
+
+	return 0;
+}
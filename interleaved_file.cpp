@@ -0,0 +1,94 @@
+/* interleaved_file.cpp - Implements a file interleaving the frames of channels
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "interleaved_file.h"
+
+InterleavedFile::InterleavedFile(File* const* frames, uint8_t resolution,
+	uint8_t record_length, uint8_t leader):
+	File(),
+	unit(resolution == 10 ? 5: 1) // In 10 bits, 4 samples take 5 bytes.
+{
+	size = header_length;
+
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		this->frames[i] = frames[i];
+		size += frames[i]->size;
+	}
+
+	header[0] = NUMBER_OF_CHANNELS;
+	header[1] = resolution;
+	header[2] = record_length;
+	header[3] = leader;
+}
+
+InterleavedFile::~InterleavedFile(void)
+{
+	for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+	{
+		delete frames[i]; // Release the frame.
+	}
+}
+
+size_t InterleavedFile::read(char* buffer, size_t length)
+{
+	size_t read = 0;
+
+	while(read < length && _cursor < size)
+	{
+		if(_cursor < header_length) // If the header is being read.
+		{
+			buffer[read++] = header[_cursor++];
+
+			continue;
+		}
+
+		// The position in the interleaved units of every channel.
+		size_t position = _cursor - header_length;
+		size_t index = position / unit;
+		uint8_t offset = position - index * unit; // The position in the unit.
+
+		File* frame = frames[index % NUMBER_OF_CHANNELS];
+
+		// The bytes left in the unit of that channel.
+		size_t left = unit - offset;
+
+		if(left > length - read)
+		{
+			left = length - read;
+		}
+
+		// Read from the unit of that channel.
+		frame->cursor(index / NUMBER_OF_CHANNELS * unit + offset);
+		left = frame->read(buffer + read, left);
+
+		if(!left) // If the frame could not be read.
+		{
+			break;
+		}
+
+		read += left;
+		_cursor += left;
+	}
+
+	return read;
+}
+
+size_t InterleavedFile::write(const char* buffer, size_t length)
+{
+	return 0; // Frames are read-only.
+}
@@ -0,0 +1,93 @@
+/* interleaved_file.h - Implements a file interleaving the frames of channels
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INTERLEAVED_FILE_H_
+#define INTERLEAVED_FILE_H_
+
+#include <utils/file.h>
+#include "channel.h"
+#include "pool.h"
+
+/**
+ * A read-only file that interleaves frames of the same size from every
+ * channel into a single one, so they can be sent in a single response.
+ *
+ * The file starts with a header of 4 bytes:
+ * - the number of channels.
+ * - the resolution of the samples in bits.
+ * - the record length, the number of samples per channel.
+ * - the number of the channel that triggered, starting from 1.
+ *
+ * It is followed by the first sample of every channel, then the second one and
+ * so on. In 10 bits resolution, groups of 4 samples are interleaved instead.
+ * */
+class InterleavedFile: public File
+{
+	protected:
+
+		/// The length of the header.
+		static const uint8_t header_length = 4;
+
+		/// The frame of every channel, deleted with the file.
+		File* frames[NUMBER_OF_CHANNELS];
+
+		/// The header.
+		uint8_t header[header_length];
+
+		/// The number of bytes taken by a sample or a group of samples.
+		uint8_t unit;
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param frames the frame of every channel, they must have the same
+		 * size. They are deleted with this file.
+		 * @param resolution the resolution of the samples in bits.
+		 * @param record_length the number of samples per channel.
+		 * @param leader the number of the channel that triggered.
+		 * */
+		InterleavedFile(File* const* frames, uint8_t resolution,
+			uint8_t record_length, uint8_t leader);
+
+		/// Class destructor.
+		virtual ~InterleavedFile(void);
+
+		/**
+		 * Read the interleaved frames.
+		 * @param buffer the buffer to read into.
+		 * @param length the number of bytes to read.
+		 * @return the number of bytes read.
+		 * */
+		virtual size_t read(char* buffer, size_t length);
+
+		/**
+		 * Frames are read-only, nothing gets written.
+		 * @return 0.
+		 * */
+		virtual size_t write(const char* buffer, size_t length);
+};
+
+/** The interleaved files in their pool, the page polls /all once at a
+ * time. */
+#define INTERLEAVED_FILE_POOL_COUNT 1
+
+/// Interleaved files taken from a pool, see Pooled.
+typedef Pooled<InterleavedFile, INTERLEAVED_FILE_POOL_COUNT>
+	PooledInterleavedFile;
+
+#endif /* INTERLEAVED_FILE_H_ */
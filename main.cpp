@@ -16,8 +16,11 @@
  */
 
 #include "channel.h"
+#include "acquisition.h"
+#include "stats.h"
+#include "assets.h"
 #include <tcpip/tcpip.h>
-//#include <eeprom/eeprom_24LCxx.h>
+#include <eeprom/eeprom_24LCxx.h>
 #include <core/processing.h>
 #include <led/blink.h>
 #include <pal/pal.h>
@@ -28,7 +31,8 @@
  * It is meant to run on an arduino duemilanove with a 24LC256 EEPROM for storage
  * and a Microchip ENC28J60 network interface for ethernet.
  *
- * It uses the ATMega328P's two first ADC pins as channels for signal acquisition.
+ * It uses the ATMega328P's ADC pins listed in CHANNEL_INPUTS as channels for
+ * signal acquisition, NUMBER_OF_CHANNELS of them.
  * */
 int main(void)
 {
@@ -36,16 +40,70 @@ int main(void)
 
 	Processing oscilloscope(NULL); // The processing resource.
 	TCPIPStack tcpip; // The TCPIP stack interfacing with the ENC28J60.
-	EEPROM_24LCXX eeprom; // The EEPROM that stores the CSS, JS and HTML files.
-	Channel channe1(1); // The oscilloscope's first channel.
+	// The EEPROM that stores files, the web interface is mirrored by web.
+	EEPROM_24LCXX eeprom;
+	Channel channel1(1); // The oscilloscope's first channel.
+#if NUMBER_OF_CHANNELS > 1
 	Channel channel2(2); // The oscilloscope's second channel.
+#endif
+#if NUMBER_OF_CHANNELS > 2
+	Channel channel3(3);
+#endif
+#if NUMBER_OF_CHANNELS > 3
+	Channel channel4(4);
+#endif
+#if NUMBER_OF_CHANNELS > 4
+	Channel channel5(5);
+#endif
+#if NUMBER_OF_CHANNELS > 5
+	Channel channel6(6);
+#endif
+
+	// The channels acquired together.
+	Channel* channels[NUMBER_OF_CHANNELS] = { &channel1,
+#if NUMBER_OF_CHANNELS > 1
+		&channel2,
+#endif
+#if NUMBER_OF_CHANNELS > 2
+		&channel3,
+#endif
+#if NUMBER_OF_CHANNELS > 3
+		&channel4,
+#endif
+#if NUMBER_OF_CHANNELS > 4
+		&channel5,
+#endif
+#if NUMBER_OF_CHANNELS > 5
+		&channel6,
+#endif
+	};
+	Acquisition all(channels); // The frames of every channel at once.
+	Statistics stats(channels); // The performance counters.
+	Assets web; // The web interface mirrored in program memory.
 
 	 // Redirect the server's root to this url.
-	oscilloscope.redirect_url = "/fs/main.xhtml";
+	oscilloscope.redirect_url = "/web/main.xhtml";
 
 	// Add all the resources as child of the processing resource.
 	oscilloscope.add_child("ch1", &channel1);
+#if NUMBER_OF_CHANNELS > 1
 	oscilloscope.add_child("ch2", &channel2);
+#endif
+#if NUMBER_OF_CHANNELS > 2
+	oscilloscope.add_child("ch3", &channel3);
+#endif
+#if NUMBER_OF_CHANNELS > 3
+	oscilloscope.add_child("ch4", &channel4);
+#endif
+#if NUMBER_OF_CHANNELS > 4
+	oscilloscope.add_child("ch5", &channel5);
+#endif
+#if NUMBER_OF_CHANNELS > 5
+	oscilloscope.add_child("ch6", &channel6);
+#endif
+	oscilloscope.add_child("all", &all);
+	oscilloscope.add_child("stats", &stats);
+	oscilloscope.add_child("web", &web);
 	oscilloscope.add_child("fs", &eeprom);
 	oscilloscope.add_child("tcpip", &tcpip);
 
@@ -0,0 +1,178 @@
+/* pool.h - Fixed-size object pools
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef POOL_H_
+#define POOL_H_
+
+#include <core/resource.h>
+#include <utils/template.h>
+#include <utils/pgmspace_file.h>
+#include <avr/io.h>
+#include <stddef.h>
+
+/** The RAM in bytes the pools of files can take out of the 2 KB of the MCU,
+ * next to CHANNELS_RAM_BUDGET. Each pool is sized for the responses that can
+ * hold one of its files at once, more files come from the heap. The build
+ * fails if the pools do not fit in it. */
+#define FILE_POOLS_RAM_BUDGET 512
+
+/** The parameters, measurements and segments templates in their pool. The
+ * page requests the parameters of every channel when it loads. */
+#define TEMPLATE_POOL_COUNT 2
+
+/// The program memory files in their pool, a template's each and an asset.
+#define PGMSPACE_FILE_POOL_COUNT 3
+
+/**
+ * A fixed number of memory slots of the same size reserved at compile time.
+ * Taking a slot and giving it back takes a constant time and never
+ * fragments the heap.
+ * @param size the size of a slot in bytes.
+ * @param count the number of slots, up to 8.
+ * */
+template<size_t size, uint8_t count> class Pool
+{
+	protected:
+
+		/// The memory of the slots.
+		uint8_t slots[count][size];
+
+		/// The slots that are taken, one bit each.
+		uint8_t taken;
+
+	public:
+
+		/// Class constructor.
+		Pool(void): taken(0) {}
+
+		/**
+		 * Take a free slot.
+		 * @return the slot, NULL if they are all taken.
+		 * */
+		void* take(void)
+		{
+			void* slot = NULL;
+
+			ATOMIC // Like ts_malloc(), pools can be used from any context.
+			{
+				for(uint8_t i = 0; i < count; i++)
+				{
+					if(!(taken & _BV(i))) // If the slot is free.
+					{
+						taken |= _BV(i);
+						slot = slots[i];
+						break;
+					}
+				}
+			}
+
+			return slot;
+		}
+
+		/**
+		 * Give back a slot.
+		 * @param slot the slot.
+		 * @return false if the memory does not come from this pool.
+		 * */
+		bool give(void* slot)
+		{
+			// If the memory is not one of the slots.
+			if((uint8_t*)slot < slots[0] || (uint8_t*)slot >= slots[count])
+			{
+				return false;
+			}
+
+			ATOMIC
+			{
+				taken &= ~_BV(((uint8_t*)slot - slots[0]) / size);
+			}
+
+			return true;
+		}
+};
+
+/**
+ * A class whose instances are allocated from a pool of their own, or from
+ * the heap once it is exhausted. They get deleted like any other object.
+ * @param T the class.
+ * @param count the number of instances in the pool, up to 8.
+ * */
+template<class T, uint8_t count> class Pooled: public T
+{
+	protected:
+
+		/// The pool the instances come from.
+		static Pool<sizeof(T), count> pool;
+
+	public:
+
+		/// The RAM in bytes taken by the pool.
+		static const size_t ram = sizeof(Pool<sizeof(T), count>);
+
+		/**
+		 * Class constructors, the arguments are passed to the constructor of
+		 * the class.
+		 * */
+		template<typename A> Pooled(const A& a): T(a) {}
+
+		/// See Pooled(const A&).
+		template<typename A, typename B> Pooled(const A& a, const B& b):
+			T(a, b) {}
+
+		/// See Pooled(const A&).
+		template<typename A, typename B, typename C, typename D>
+			Pooled(const A& a, const B& b, const C& c, const D& d):
+			T(a, b, c, d) {}
+
+		/// See Pooled(const A&).
+		template<typename A, typename B, typename C, typename D, typename E>
+			Pooled(const A& a, const B& b, const C& c, const D& d, const E& e):
+			T(a, b, c, d, e) {}
+
+		/**
+		 * @param size the size of the object.
+		 * @return memory for the object, NULL if there is none left.
+		 * */
+		static void* operator new(size_t size)
+		{
+			// A class deriving from this one may not fit in a slot.
+			void* memory = size <= sizeof(T) ? pool.take(): NULL;
+
+			return memory ? memory: ::operator new(size);
+		}
+
+		/**
+		 * @param memory the memory of an object to give back.
+		 * */
+		static void operator delete(void* memory)
+		{
+			if(!pool.give(memory)) // If the object came from the heap.
+			{
+				::operator delete(memory);
+			}
+		}
+};
+
+template<class T, uint8_t count> Pool<sizeof(T), count> Pooled<T, count>::pool;
+
+/// The files holding the parameters of the resources.
+typedef Pooled<PGMSpaceFile, PGMSPACE_FILE_POOL_COUNT> PooledPGMSpaceFile;
+
+/// The templates filling in the parameters of the resources.
+typedef Pooled<Template, TEMPLATE_POOL_COUNT> PooledTemplate;
+
+#endif /* POOL_H_ */
@@ -0,0 +1,277 @@
+/* spectrum_file.cpp - A file that sends the spectrum of a frame
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "spectrum_file.h"
+#include <string.h>
+#include <avr/pgmspace.h>
+
+/** A quarter of a sine period in Q15, sin(2 * pi * i / FFT_MAX_POINTS). The
+ * twiddle factors and the windows are taken from it. */
+static const int16_t sine_P[FFT_MAX_POINTS / 4 + 1] PROGMEM =
+{
+	0, 1608, 3212, 4808, 6393, 7962, 9512, 11039,
+	12539, 14010, 15446, 16846, 18204, 19519, 20787, 22005,
+	23170, 24279, 25329, 26319, 27245, 28105, 28898, 29621,
+	30273, 30852, 31356, 31785, 32137, 32412, 32609, 32728,
+	32767
+};
+
+/// The coefficients of the flat-top window in Q15, alternating in sign.
+static const int16_t flat_top_P[5] PROGMEM = { 7064, 13652, 9085, 2739, 228 };
+
+/**
+ * Get a sine from the quarter period table.
+ * @param i the angle in 1 / FFT_MAX_POINTS of a period, it wraps around.
+ * @return the sine in Q15.
+ * */
+static int16_t sine(uint16_t i)
+{
+	const uint8_t quarter = FFT_MAX_POINTS / 4;
+
+	i &= FFT_MAX_POINTS - 1;
+
+	if(i <= quarter) // If this is the first quarter.
+	{
+		return pgm_read_word(&sine_P[i]);
+	}
+	else if(i <= 2 * quarter) // If this is the second quarter.
+	{
+		return pgm_read_word(&sine_P[2 * quarter - i]);
+	}
+	else if(i <= 3 * quarter) // If this is the third quarter.
+	{
+		return -pgm_read_word(&sine_P[i - 2 * quarter]);
+	}
+
+	return -pgm_read_word(&sine_P[4 * quarter - i]);
+}
+
+/**
+ * Get a cosine from the quarter period table.
+ * @param i the angle in 1 / FFT_MAX_POINTS of a period, it wraps around.
+ * @return the cosine in Q15.
+ * */
+static inline int16_t cosine(uint16_t i)
+{
+	return sine(i + FFT_MAX_POINTS / 4);
+}
+
+/**
+ * Get the logarithm of the power of a bin.
+ * @param power the power.
+ * @return 8 times its base 2 logarithm, the fraction taken from the bits
+ * following the highest one.
+ * */
+static uint8_t level(uint32_t power)
+{
+	if(!power)
+	{
+		return 0;
+	}
+
+	uint8_t exponent = 31;
+
+	while(!(power & 0x80000000UL)) // Find the highest bit.
+	{
+		power <<= 1;
+		exponent--;
+	}
+
+	return exponent << 3 | (power >> 28 & 7);
+}
+
+SpectrumFile::SpectrumFile(uint8_t* bins, size_t length):
+	File(),
+	bins(bins)
+{
+	size = length;
+}
+
+SpectrumFile::~SpectrumFile(void)
+{
+	ts_free(bins); // The bins are only sent once.
+}
+
+size_t SpectrumFile::read(char* buffer, size_t length)
+{
+	// If there is not enough data left for the requested length.
+	if(_cursor + length > size)
+	{
+		length = size - _cursor; // Only read what is left.
+	}
+
+	memcpy(buffer, bins + _cursor, length);
+
+	_cursor += length; // Move the cursor forward.
+
+	return length;
+}
+
+size_t SpectrumFile::write(const char* buffer, size_t length)
+{
+	return 0; // Spectra are read-only.
+}
+
+uint8_t SpectrumFile::points(uint8_t record_length)
+{
+	uint8_t points;
+
+	for(points = FFT_MAX_POINTS; points > record_length; points >>= 1);
+
+	return points;
+}
+
+void SpectrumFile::apply_window(int16_t* samples, uint8_t points,
+	uint8_t window)
+{
+	if(window == WINDOW_NONE)
+	{
+		return;
+	}
+
+	// The angle of a sample in the table, a window spans a period.
+	uint8_t step = FFT_MAX_POINTS / points;
+
+	for(uint8_t i = 0; i < points; i++)
+	{
+		int32_t gain;
+
+		if(window == WINDOW_HANN)
+		{
+			gain = (32767L - cosine(i * step)) >> 1;
+		}
+		else
+		{
+			gain = pgm_read_word(&flat_top_P[0]);
+
+			// Add the harmonics of the window, every other one is subtracted.
+			for(uint8_t h = 1; h < 5; h++)
+			{
+				int32_t term = (int32_t)(int16_t)pgm_read_word(&flat_top_P[h]) *
+					cosine(h * i * step) >> 15;
+
+				gain += h & 1 ? -term: term;
+			}
+
+			if(gain > 32767) // The coefficients add up to 1 in the middle.
+			{
+				gain = 32767;
+			}
+		}
+
+		samples[i] = samples[i] * gain >> 15;
+	}
+}
+
+uint8_t SpectrumFile::transform(int16_t* samples, uint8_t points)
+{
+	/* The even samples are the real parts and the odd ones the imaginary
+	 * parts of half as many complex samples, as they are laid out. */
+	uint8_t half = points / 2;
+
+	// Put the complex samples in bit reversed order.
+	for(uint8_t i = 1, j = 0; i < half; i++)
+	{
+		uint8_t bit = half >> 1;
+
+		for(; j & bit; bit >>= 1)
+		{
+			j ^= bit;
+		}
+
+		j |= bit;
+
+		if(i < j)
+		{
+			int16_t* a = samples + 2 * i;
+			int16_t* b = samples + 2 * j;
+			int16_t t;
+
+			t = a[0]; a[0] = b[0]; b[0] = t;
+			t = a[1]; a[1] = b[1]; b[1] = t;
+		}
+	}
+
+	/* Combine the transforms of twice as many samples at each stage. Every
+	 * butterfly is halved so its magnitude stays within the full scale. */
+	for(uint8_t length = 2; length <= half; length <<= 1)
+	{
+		uint8_t step = FFT_MAX_POINTS / length;
+
+		// The twiddle factor is the same for a position in every transform.
+		for(uint8_t k = 0; k < length / 2; k++)
+		{
+			int32_t wr = cosine(k * step);
+			int32_t wi = -sine(k * step);
+
+			for(uint8_t i = k; i < half; i += length)
+			{
+				int16_t* a = samples + 2 * i;
+				int16_t* b = samples + 2 * (i + length / 2);
+
+				int32_t tr = (wr * b[0] - wi * b[1]) >> 15;
+				int32_t ti = (wr * b[1] + wi * b[0]) >> 15;
+
+				b[0] = (a[0] - tr) >> 1;
+				b[1] = (a[1] - ti) >> 1;
+				a[0] = (a[0] + tr) >> 1;
+				a[1] = (a[1] + ti) >> 1;
+			}
+		}
+	}
+
+	/* Split the transform into the bins of the real samples. Bins k and
+	 * half - k come from the same two complex values, so their levels are
+	 * stored in place of the real parts of these. */
+	uint8_t step = FFT_MAX_POINTS / points;
+
+	samples[0] = level(((int32_t)samples[0] + samples[1]) *
+		((int32_t)samples[0] + samples[1]) >> 2);
+
+	for(uint8_t k = 1; k <= half / 2; k++)
+	{
+		int16_t* a = samples + 2 * k;
+		int16_t* b = samples + 2 * (half - k);
+
+		// The transforms of the even and odd samples.
+		int32_t even_r = ((int32_t)a[0] + b[0]) >> 1;
+		int32_t even_i = ((int32_t)a[1] - b[1]) >> 1;
+		int32_t odd_r = ((int32_t)a[0] - b[0]) >> 1;
+		int32_t odd_i = ((int32_t)a[1] + b[1]) >> 1;
+
+		int32_t c = cosine(k * step);
+		int32_t s = sine(k * step);
+
+		int32_t r = (c * odd_i - s * odd_r) >> 15;
+		int32_t i = (c * odd_r + s * odd_i) >> 15;
+
+		// The bins are halved so their power fits.
+		int32_t ar = (even_r + r) >> 1, ai = (even_i - i) >> 1;
+		int32_t br = (even_r - r) >> 1, bi = (-even_i - i) >> 1;
+
+		a[0] = level(ar * ar + ai * ai);
+		b[0] = level(br * br + bi * bi);
+	}
+
+	// Pack the levels, a byte never overwrites a level not read yet.
+	for(uint8_t k = 0; k < half; k++)
+	{
+		((uint8_t*)samples)[k] = samples[2 * k];
+	}
+
+	return half;
+}
@@ -0,0 +1,109 @@
+/* spectrum_file.h - A file that sends the spectrum of a frame
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SPECTRUM_FILE_H_
+#define SPECTRUM_FILE_H_
+
+#include <utils/file.h>
+#include "pool.h"
+
+/// The most samples transformed, the twiddle factors are for that many.
+#define FFT_MAX_POINTS 128
+
+/// The window applied to the samples before they are transformed.
+#define WINDOW_NONE 0
+#define WINDOW_HANN 1 ///< See WINDOW_NONE.
+#define WINDOW_FLAT_TOP 2 ///< See WINDOW_NONE, for accurate amplitudes.
+
+/**
+ * A read-only file that sends the spectrum of a frame, a bin per byte from
+ * the DC one. A bin is 8 times the base 2 logarithm of its power, so each
+ * step is about 0.38 dB, and a full scale sine without a window gets 208.
+ *
+ * The samples are transformed in place in Q15 fixed point. The N real
+ * samples are transformed as N / 2 complex ones then split into the N / 2
+ * bins, so the transform only takes 2 bytes per sample.
+ * */
+class SpectrumFile: public File
+{
+	protected:
+
+		/// The bins, allocated with ts_malloc() and freed with the file.
+		uint8_t* bins;
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param bins the bins, the file frees them once it is deleted.
+		 * @param length the number of bins.
+		 * */
+		SpectrumFile(uint8_t* bins, size_t length);
+
+		/// Class destructor.
+		virtual ~SpectrumFile(void);
+
+		/**
+		 * Read the bins.
+		 * @param buffer the buffer to read into.
+		 * @param length the number of bytes to read.
+		 * @return the number of bytes read.
+		 * */
+		virtual size_t read(char* buffer, size_t length);
+
+		/**
+		 * Spectra are read-only, nothing gets written.
+		 * @return 0.
+		 * */
+		virtual size_t write(const char* buffer, size_t length);
+
+		/**
+		 * Get the number of samples transformed out of a frame.
+		 * @param record_length the number of samples in the frame.
+		 * @return the highest power of two up to FFT_MAX_POINTS that fits.
+		 * */
+		static uint8_t points(uint8_t record_length);
+
+		/**
+		 * Apply a window to the samples.
+		 * @param samples the samples in Q15.
+		 * @param points the number of samples, a power of two.
+		 * @param window WINDOW_NONE, WINDOW_HANN or WINDOW_FLAT_TOP.
+		 * */
+		static void apply_window(int16_t* samples, uint8_t points,
+			uint8_t window);
+
+		/**
+		 * Transform the samples into bins in place.
+		 * @param samples the samples in Q15, each within half of the full
+		 * scale so the butterflies do not overflow.
+		 * @param points the number of samples, a power of two from 4 up to
+		 * FFT_MAX_POINTS.
+		 * @return the number of bins, points / 2, stored as bytes from the
+		 * start of the samples.
+		 * */
+		static uint8_t transform(int16_t* samples, uint8_t points);
+};
+
+/** The spectrum files in their pool. Their bins take the heap, so a single
+ * spectrum is sent at a time. */
+#define SPECTRUM_FILE_POOL_COUNT 1
+
+/// Spectrum files taken from a pool, see Pooled.
+typedef Pooled<SpectrumFile, SPECTRUM_FILE_POOL_COUNT> PooledSpectrumFile;
+
+#endif /* SPECTRUM_FILE_H_ */
@@ -0,0 +1,76 @@
+/* stats.cpp - Implements a runtime statistics resource
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stats.h"
+#include "stats_file.h"
+
+/// The end of the memory used by the heap, set by malloc().
+extern char* __brkval;
+
+/// The start of the heap, set by the linker.
+extern char __heap_start;
+
+uint16_t Statistics::allocation_failures = 0;
+
+uint16_t Statistics::heap_low = 0xFFFF;
+
+Statistics::Statistics(Channel** channels):
+	Resource(),
+	channels(channels)
+{}
+
+void Statistics::sample_heap(void)
+{
+	char top; // Sits at the top of the stack.
+
+	uint16_t left = &top - (__brkval ? __brkval: &__heap_start);
+
+	if(left < heap_low)
+	{
+		heap_low = left;
+	}
+}
+
+Response::status_code Statistics::process(Request* request, Response* response)
+{
+	if(!request->to_destination()) // If the request is at destination.
+	{
+		if(request->is_method(Request::GET)) // If this is a GET request.
+		{
+			sample_heap(); // The request is on the heap.
+
+			// Take a snapshot of the counters.
+			File* body = new StatsFile(channels);
+
+			// If there was not enough memory to allocate the file.
+			if(!body)
+			{
+				// Not enough resources to process the request.
+				return SERVICE_UNAVAILABLE_503;
+			}
+
+			// Set the counters file as the response body.
+			response->set_body(body, MIME::APPLICATION_JSON);
+
+			return OK_200;
+		}
+
+		return NOT_IMPLEMENTED_501; // Request method not implemented.
+	}
+
+	return PASS_308; // Cannot process this request.
+}
@@ -0,0 +1,124 @@
+/* stats.h - Implements a runtime statistics resource
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STATS_H_
+#define STATS_H_
+
+#include <core/resource.h>
+
+class Channel;
+
+/** The ISR is timed once every ISR_TIMING_MASK + 1 conversions of a channel,
+ * must be a power of two minus one. */
+#define ISR_TIMING_MASK 0x0F
+
+/**
+ * The counters kept by a channel. They are only incremented so they cost a
+ * few cycles and can stay enabled.
+ * */
+struct channel_stats_t
+{
+	/// The number of times the ISR stored a sample of the channel.
+	uint32_t conversions;
+
+	/// The longest ISR timed, in CPU cycles.
+	uint16_t isr_max;
+
+	/// The sum of the durations of the ISR timed, in CPU cycles.
+	uint32_t isr_total;
+
+	/// The number of times the ISR was timed.
+	uint16_t isr_timed;
+
+	/// The number of frames completed.
+	uint32_t frames;
+
+	/// The number of frames overwritten before anything read them.
+	uint16_t unread;
+
+	/** The number of samples between the trigger getting armed and firing,
+	 * for the last trigger. */
+	uint16_t trigger_latency;
+
+	/// The longest trigger latency, in samples.
+	uint16_t trigger_latency_max;
+
+	/// The number of requests waiting in the queue.
+	uint8_t queued;
+
+	/// The largest number of requests that waited in the queue.
+	uint8_t queued_max;
+
+	/// The number of requests that timed out (408).
+	uint16_t timeouts;
+
+	/// The number of requests turned down for lack of resources (503).
+	uint16_t unavailable;
+};
+
+/**
+ * This resource gives counters measuring the performance of the oscilloscope.
+ * The following are the list of sub-resources defined inside the class:
+ * - /: counters JSON object (GET, see StatsFile)
+ * */
+class Statistics: public Resource
+{
+	/// The file sending the counters needs to read them.
+	friend class StatsFile;
+
+	protected:
+
+		/// The channels of the oscilloscope.
+		Channel** channels;
+
+		/// The number of buffers that could not be allocated.
+		static uint16_t allocation_failures;
+
+		/// The fewest bytes there were between the heap and the stack.
+		static uint16_t heap_low;
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param channels the NUMBER_OF_CHANNELS channels of the oscilloscope.
+		 * */
+		Statistics(Channel** channels);
+
+		/// Count a buffer that could not be allocated.
+		static inline void allocation_failed(void) { allocation_failures++; }
+
+		/**
+		 * Measure the memory left between the heap and the stack and keep the
+		 * lowest value. It is cheap enough to be called whenever the heap
+		 * was used.
+		 * */
+		static void sample_heap(void);
+
+	protected:
+
+        /// Process a request message.
+        /**
+         * @param request the request to process.
+         * @param response the response to fill if a response should be returned (which
+         * depends on the status code).
+         * @return the status_code produced while processing the request.
+         */
+		virtual Response::status_code process(Request* request, Response* response);
+};
+
+#endif /* STATS_H_ */
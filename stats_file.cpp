@@ -0,0 +1,212 @@
+/* stats_file.cpp - A file that sends the counters of the oscilloscope
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stats_file.h"
+#include "stats.h"
+#include <string.h>
+#include <stdlib.h>
+#include <avr/pgmspace.h>
+
+static const char heap_low_P[] PROGMEM = "heap_low";
+static const char allocation_failures_P[] PROGMEM = "allocation_failures";
+
+/// The names of the counters that are not kept by a channel.
+static PGM_P const global_names_P[GLOBAL_COUNTERS] PROGMEM =
+{
+	heap_low_P,
+	allocation_failures_P
+};
+
+static const char conversions_P[] PROGMEM = "conversions";
+static const char isr_max_P[] PROGMEM = "isr_max";
+static const char isr_avg_P[] PROGMEM = "isr_avg";
+static const char frames_P[] PROGMEM = "frames";
+static const char unread_P[] PROGMEM = "unread";
+static const char dropped_P[] PROGMEM = "dropped";
+static const char trigger_latency_P[] PROGMEM = "trigger_latency";
+static const char trigger_latency_max_P[] PROGMEM = "trigger_latency_max";
+static const char queue_max_P[] PROGMEM = "queue_max";
+static const char timeouts_P[] PROGMEM = "timeouts";
+static const char unavailable_P[] PROGMEM = "unavailable";
+
+/// The names of the counters of each channel.
+static PGM_P const channel_names_P[CHANNEL_COUNTERS] PROGMEM =
+{
+	conversions_P,
+	isr_max_P,
+	isr_avg_P,
+	frames_P,
+	unread_P,
+	dropped_P,
+	trigger_latency_P,
+	trigger_latency_max_P,
+	queue_max_P,
+	timeouts_P,
+	unavailable_P
+};
+
+StatsFile::StatsFile(Channel** channels):
+	File(),
+	counter(0),
+	text_length(0),
+	text_ptr(0)
+{
+	ATOMIC // The ISR updates most counters.
+	{
+		values[0] = Statistics::heap_low;
+		values[1] = Statistics::allocation_failures;
+
+		uint32_t* value = values + GLOBAL_COUNTERS;
+
+		for(uint8_t i = 0; i < NUMBER_OF_CHANNELS; i++)
+		{
+			const channel_stats_t& stats = channels[i]->stats;
+
+			*value++ = stats.conversions;
+			*value++ = stats.isr_max;
+			*value++ = stats.isr_timed ? stats.isr_total / stats.isr_timed: 0;
+			*value++ = stats.frames;
+			*value++ = stats.unread;
+			*value++ = channels[i]->dropped;
+			*value++ = stats.trigger_latency;
+			*value++ = stats.trigger_latency_max;
+			*value++ = stats.queued_max;
+			*value++ = stats.timeouts;
+			*value++ = stats.unavailable;
+		}
+	}
+
+	size = 0;
+
+	// The length of the text is only known once it is generated.
+	for(uint8_t i = 0; i <= COUNTERS; i++)
+	{
+		size += render(i, text);
+	}
+}
+
+uint8_t StatsFile::render(uint8_t counter, char* buffer)
+{
+	if(counter == COUNTERS) // If this is the end of the object.
+	{
+		strcpy_P(buffer, PSTR("}]}"));
+
+		return 3;
+	}
+
+	uint8_t length;
+	PGM_P name;
+
+	if(counter < GLOBAL_COUNTERS) // If the counter is not kept by a channel.
+	{
+		buffer[0] = counter ? ',': '{';
+		buffer[1] = '"';
+		length = 2;
+
+		name = (PGM_P)pgm_read_word(&global_names_P[counter]);
+	}
+	else
+	{
+		uint8_t index = (counter - GLOBAL_COUNTERS) % CHANNEL_COUNTERS;
+
+		if(index) // If this is not the first counter of the channel.
+		{
+			strcpy_P(buffer, PSTR(",\""));
+		}
+		else if(counter == GLOBAL_COUNTERS) // If this is the first channel.
+		{
+			strcpy_P(buffer, PSTR(",\"channels\":[{\""));
+		}
+		else
+		{
+			strcpy_P(buffer, PSTR("},{\""));
+		}
+
+		length = strlen(buffer);
+
+		name = (PGM_P)pgm_read_word(&channel_names_P[index]);
+	}
+
+	strcpy_P(buffer + length, name);
+	length += strlen(buffer + length);
+
+	buffer[length++] = '"';
+	buffer[length++] = ':';
+
+	ultoa(values[counter], buffer + length, 10);
+
+	return length + strlen(buffer + length);
+}
+
+size_t StatsFile::advance(char* buffer, size_t length)
+{
+	size_t moved = 0;
+
+	while(moved < length)
+	{
+		if(text_ptr == text_length) // If the text of the last counter was sent.
+		{
+			if(counter > COUNTERS) // If the end of the object was sent.
+			{
+				break;
+			}
+
+			text_length = render(counter++, text);
+			text_ptr = 0;
+		}
+
+		uint8_t chunk = text_length - text_ptr;
+
+		if(chunk > length - moved)
+		{
+			chunk = length - moved;
+		}
+
+		if(buffer)
+		{
+			memcpy(buffer + moved, text + text_ptr, chunk);
+		}
+
+		text_ptr += chunk;
+		moved += chunk;
+	}
+
+	_cursor += moved;
+
+	return moved;
+}
+
+size_t StatsFile::read(char* buffer, size_t length)
+{
+	return advance(buffer, length);
+}
+
+size_t StatsFile::write(const char* buffer, size_t length)
+{
+	return 0; // Counters are read-only.
+}
+
+void StatsFile::cursor(size_t position)
+{
+	// Generate the text again from the start.
+	counter = 0;
+	text_length = 0;
+	text_ptr = 0;
+	_cursor = 0;
+
+	advance(NULL, position);
+}
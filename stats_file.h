@@ -0,0 +1,112 @@
+/* stats_file.h - A file that sends the counters of the oscilloscope
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STATS_FILE_H_
+#define STATS_FILE_H_
+
+#include <utils/file.h>
+#include "channel.h"
+
+/// The number of counters that are not kept by a channel.
+#define GLOBAL_COUNTERS 2
+
+/// The number of counters of each channel.
+#define CHANNEL_COUNTERS 11
+
+/// The number of counters sent.
+#define COUNTERS (GLOBAL_COUNTERS + NUMBER_OF_CHANNELS * CHANNEL_COUNTERS)
+
+/**
+ * A read-only file that sends a snapshot of the counters as a JSON object:
+ * {"heap_low":bytes,"allocation_failures":n,"channels":[{...},...]}
+ * Each channel has "conversions", "isr_max" and "isr_avg" in CPU cycles,
+ * "frames", "unread", "dropped", "trigger_latency" and "trigger_latency_max"
+ * in samples, "queue_max", "timeouts" and "unavailable".
+ *
+ * The text is generated one counter at a time as it gets read, so it does
+ * not need to be held in memory.
+ * */
+class StatsFile: public File
+{
+	protected:
+
+		/// The counters when the file was created, in the order they are sent.
+		uint32_t values[COUNTERS];
+
+		/// The next counter to generate the text of.
+		uint8_t counter;
+
+		/// The text of the last counter generated.
+		char text[40];
+
+		/// The length of the text.
+		uint8_t text_length;
+
+		/// The position in the text of the next character to send.
+		uint8_t text_ptr;
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param channels the NUMBER_OF_CHANNELS channels of the oscilloscope.
+		 * */
+		StatsFile(Channel** channels);
+
+		/**
+		 * Read the counters.
+		 * @param buffer the buffer to read into.
+		 * @param length the number of bytes to read.
+		 * @return the number of bytes read.
+		 * */
+		virtual size_t read(char* buffer, size_t length);
+
+		/**
+		 * Counters are read-only, nothing gets written.
+		 * @return 0.
+		 * */
+		virtual size_t write(const char* buffer, size_t length);
+
+		using File::cursor;
+
+		/**
+		 * Move the cursor.
+		 * @param position the new position of the cursor.
+		 * */
+		virtual void cursor(size_t position);
+
+	protected:
+
+		/**
+		 * Generate the text of a counter, along with the JSON that precedes it.
+		 * @param counter the index of the counter, COUNTERS for the end of the
+		 * object.
+		 * @param buffer where to put the text, must hold 40 characters.
+		 * @return the length of the text.
+		 * */
+		uint8_t render(uint8_t counter, char* buffer);
+
+		/**
+		 * Move forward in the text, generating it as needed.
+		 * @param buffer where to copy the text, NULL to skip it.
+		 * @param length the number of characters to move by.
+		 * @return the number of characters moved by.
+		 * */
+		size_t advance(char* buffer, size_t length);
+};
+
+#endif /* STATS_FILE_H_ */
@@ -0,0 +1,168 @@
+/* stream_file.cpp - Implements a file that streams the frames of a channel
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stream_file.h"
+#include "channel.h"
+#include "frame_header_file.h"
+#include <string.h>
+#include <avr/io.h>
+#include <avr_pal.h>
+
+/// The length of a chunk header, the size in 4 hexadecimal digits and CRLF.
+#define HEADER_LENGTH 6
+
+/// The length of a chunk trailer.
+#define TRAILER_LENGTH 2
+
+/// The last chunk, it ends the stream.
+#define LAST_CHUNK "0\r\n\r\n"
+
+/// The length of the last chunk.
+#define LAST_CHUNK_LENGTH sizeof(LAST_CHUNK) - 1
+
+StreamFile::StreamFile(Channel* channel):
+	File(),
+	channel(channel),
+	frame_length(channel->frame_size() + sizeof(frame_header_t)),
+	frames_left(max_frames),
+	frame(NULL),
+	text_length(0),
+	text_ptr(0)
+{
+	ATOMIC
+	{
+		sequence = channel->frame_sequence();
+
+		if(channel->frame_ready()) // If a frame is ready.
+		{
+			sequence--; // Start the stream with it.
+		}
+	}
+
+	// The longest the stream can be if it is not ended early.
+	size = max_frames * (HEADER_LENGTH + frame_length + TRAILER_LENGTH) +
+		LAST_CHUNK_LENGTH;
+}
+
+StreamFile::~StreamFile(void)
+{
+	if(frame) // If a frame was being sent.
+	{
+		delete frame; // Release the frame.
+	}
+}
+
+void StreamFile::end(size_t sent)
+{
+	memcpy(text + text_length, LAST_CHUNK, LAST_CHUNK_LENGTH);
+	text_length += LAST_CHUNK_LENGTH;
+
+	frames_left = 0; // Nothing more will be sent.
+
+	// The stream ends once the text left is sent, however early that is.
+	size = sent + text_length - text_ptr;
+}
+
+size_t StreamFile::read(char* buffer, size_t length)
+{
+	size_t read = 0;
+
+	while(read < length)
+	{
+		if(text_ptr < text_length) // If there is text waiting to be sent.
+		{
+			buffer[read++] = text[text_ptr++];
+
+			continue;
+		}
+
+		text_ptr = text_length = 0;
+
+		if(frame) // If a frame is being sent.
+		{
+			read += frame->read(buffer + read, length - read);
+
+			if(frame->cursor() == frame->size) // If the whole frame was sent.
+			{
+				delete frame; // Release the frame.
+				frame = NULL;
+
+				// Terminate the chunk.
+				text[0] = '\r';
+				text[1] = '\n';
+				text_length = TRAILER_LENGTH;
+
+				if(!--frames_left) // If this was the last frame.
+				{
+					end(_cursor + read);
+				}
+			}
+
+			continue;
+		}
+
+		if(!frames_left) // If the stream has ended.
+		{
+			break;
+		}
+
+		uint16_t current = channel->frame_sequence();
+
+		// If no new frame was completed since the last one was sent.
+		if(current == sequence)
+		{
+			break; // Wait for the next one.
+		}
+
+		// If the size of the frames changed.
+		if(channel->frame_size() + sizeof(frame_header_t) != frame_length)
+		{
+			end(_cursor + read); // The client will have to reconnect.
+
+			continue;
+		}
+
+		frame = channel->get_frame(false);
+
+		if(!frame) // If the frame could not be allocated.
+		{
+			break; // Try again on the next read.
+		}
+
+		sequence = current;
+
+		// The chunk header holds the size of the frame in hexadecimal.
+		for(uint8_t i = 0; i < 4; i++)
+		{
+			uint8_t digit = (frame_length >> (12 - i * 4)) & 0x0F;
+			text[i] = digit < 10 ? '0' + digit: 'A' + digit - 10;
+		}
+
+		text[4] = '\r';
+		text[5] = '\n';
+		text_length = HEADER_LENGTH;
+	}
+
+	_cursor += read;
+
+	return read;
+}
+
+size_t StreamFile::write(const char* buffer, size_t length)
+{
+	return 0; // Streams are read-only.
+}
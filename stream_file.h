@@ -0,0 +1,106 @@
+/* stream_file.h - Implements a file that streams the frames of a channel
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STREAM_FILE_H_
+#define STREAM_FILE_H_
+
+#include <utils/file.h>
+
+class Channel;
+
+/**
+ * A read-only file that sends the frames of a channel as HTTP chunks as soon
+ * as they get completed, so a client can keep a single connection open
+ * instead of requesting every frame. Nothing gets read while no new frame is
+ * ready.
+ *
+ * The stream ends after a fixed number of frames, or as soon as the size of
+ * the frames changes, the client is expected to reconnect.
+ *
+ * The body is chunked and has no Content-Length: the framework only sends
+ * one for bodies without a Transfer-Encoding header. It reads a body until
+ * its cursor reaches its size, taking a read of nothing as data not ready
+ * yet. The size is therefore the longest the stream can be, and it is cut
+ * down to the bytes actually sent once the stream ends early, so the last
+ * chunk is always the last byte read.
+ * */
+class StreamFile: public File
+{
+	protected:
+
+		/// The number of frames sent before the stream ends.
+		static const uint8_t max_frames = 100;
+
+		/// The channel the frames come from.
+		Channel* channel;
+
+		/// The size in bytes of the frames of the channel and their metadata.
+		uint16_t frame_length;
+
+		/// The sequence number of the last frame sent.
+		uint16_t sequence;
+
+		/// The number of frames left to send before the stream ends.
+		uint8_t frames_left;
+
+		/// The frame being sent.
+		File* frame;
+
+		/// Chunk headers, trailers and the last chunk waiting to be sent.
+		char text[10];
+
+		/// The length of the text.
+		uint8_t text_length;
+
+		/// The number of bytes of the text already sent.
+		uint8_t text_ptr;
+
+	public:
+
+		/**
+		 * Class constructor.
+		 * @param channel the channel whose frames to stream.
+		 * */
+		StreamFile(Channel* channel);
+
+		/// Class destructor.
+		virtual ~StreamFile(void);
+
+		/**
+		 * Read the stream.
+		 * @param buffer the buffer to read into.
+		 * @param length the number of bytes to read.
+		 * @return the number of bytes read, 0 if no new frame is ready yet.
+		 * */
+		virtual size_t read(char* buffer, size_t length);
+
+		/**
+		 * Streams are read-only, nothing gets written.
+		 * @return 0.
+		 * */
+		virtual size_t write(const char* buffer, size_t length);
+
+	protected:
+
+		/**
+		 * End the stream with the last chunk.
+		 * @param sent the number of bytes of the stream sent so far.
+		 * */
+		void end(size_t sent);
+};
+
+#endif /* STREAM_FILE_H_ */
@@ -45,54 +45,89 @@ function draw_grid()
 	}
 }
 
-function adc_to_coord(val, vdiv)
-{
-	var ADC_min = 0;
-	var ADC_max = 5;
-	var precision = 256;
-	
-	var ppv = 500 / (vdiv * 8);
-		
-	return 250 - Math.round((val / precision) * ADC_max * ppv);
-}
-function time_to_coord(val, sr, tdiv)
-{
-	if(!val){ return 0;}
-	var ppt = 500 / (tdiv * 8);
-	return Math.round(( (1 / sr) * val ) * ppt);
-}
+/*The size of the display in pixels and the number of divisions across it.*/
+var DISPLAY_SIZE = 500;
+var DIVISIONS = 8;
+/*The voltage of the highest ADC value.*/
+var ADC_MAX = 5;
 
 function draw(channel)
 {
-	if(!channel.svg)
-	{
-		channel.svg = document.createElementNS(this.svgNS, "svg:polyline");
-		channel.svg.setAttributeNS(null, "class", "waveform");
-		this.area.appendChild(channel.svg);	
-	}
+	if(channel.sampling_size < 2){ return; }
+	
+	/*The scaling only changes with the settings, it is computed beforehand
+	(see update_scale).*/
+	var scale = channel.scale;
+	var sample = channel.sample;
+	var path = new Path2D();
+	var context = this.context;
 	
-	var style = "stroke: " + channel.get_style().color + ";" + channel.get_style().line_style;
-	channel.svg.setAttributeNS(null, "style", style);
+	context.strokeStyle = channel.style.color;
+	context.lineWidth = channel.style.width;
+	context.setLineDash(channel.style.dash);
 	
-	var points = "";
-	if(channel.sampling_size > 1)
+	if(channel.mode == 1 && channel.sampling_size > 3)
 	{
-		for(var i = 0; i < channel.sampling_size; i += 1 )
+		/*Samples are pairs of peaks, the envelope goes forward along the highest
+		ones and comes back along the lowest ones.*/
+		var pairs = Math.floor(channel.sampling_size / 2);
+		path.moveTo(0, scale.offset - sample[1] * scale.y);
+		for(var i = 1; i < pairs; i += 1)
 		{
-			var x = time_to_coord(i, channel.sampling_rate.value , channel.tdiv);
-			var y = adc_to_coord(channel.sample[i], channel.vdiv);
-			points += x + "," + y + " ";
+			path.lineTo(i * scale.x, scale.offset - sample[i * 2 + 1] * scale.y);
+		}
+		for(var i = pairs - 1; i >= 0; i -= 1)
+		{
+			path.lineTo(i * scale.x, scale.offset - sample[i * 2] * scale.y);
+		}
+		path.closePath();
+		context.fillStyle = channel.style.color;
+		context.globalAlpha = 0.3;
+		context.fill(path);
+		context.globalAlpha = 1;
+	}
+	else
+	{
+		path.moveTo(0, scale.offset - sample[0] * scale.y);
+		for(var i = 1; i < channel.sampling_size; i += 1)
+		{
+			path.lineTo(i * scale.x, scale.offset - sample[i] * scale.y);
 		}
 	}
 	
-	channel.svg.setAttributeNS(null, "points", points);
+	context.stroke(path);
+}
+
+function render()
+{
+	this.pending = false;
+	this.context.clearRect(0, 0, DISPLAY_SIZE, DISPLAY_SIZE);
+	for(var i = 0; i < this.channels.length; i += 1)
+	{
+		this.draw(this.channels[i]);
+	}
 }
 
-function Display(area)
+function request_draw()
+{
+	/*Waveforms are redrawn at most once per screen refresh, however many
+	frames arrived in the meantime.*/
+	if(this.pending){ return; }
+	this.pending = true;
+	var display = this;
+	window.requestAnimationFrame(function(){ display.render(); });
+}
+
+function Display(area, canvas)
 {
 	this.area = area;
+	this.context = canvas.getContext("2d");
+	this.channels = [];
+	this.pending = false;
 	this.draw_grid = draw_grid;
 	this.draw = draw;
+	this.render = render;
+	this.request_draw = request_draw;
 	this.create_line = create_line;
 	this.svgNS = "http://www.w3.org/2000/svg";
 }
@@ -120,7 +155,7 @@ function post_params()
 	{
 		trigger_flags += 2;
 	}
-	this.ajax_params.send("sr="+this.sampling_rate.value+"&tf="+trigger_flags+"&tl="+this.trigger_level.value);
+	this.ajax_params.send("en="+(this.enabled.checked ? 1 : 0)+"&sr="+this.sampling_rate.value+"&rl="+this.record_length.value+"&dc="+this.decimation.value+"&av="+this.averaging.value+"&et="+this.interleaving.value+"&rs="+this.resolution.value+"&am="+(this.roll.checked ? 2 : this.peak_detect.checked ? 1 : 0)+"&tf="+trigger_flags+"&tl="+this.trigger_level.value);
 }
 
 function rec_params()
@@ -132,7 +167,21 @@ function rec_params()
 			this.empty = false;
 			var settings = JSON.parse(this.ajax_params.responseText);
 			
+			if( settings.en == 1 ){ this.enabled.checked="checked"; }
+			else { this.enabled.checked=""; }
 			this.sampling_rate.value=settings.sr;
+			this.record_length.value=settings.rl;
+			this.decimation.value=settings.dc;
+			this.averaging.value=settings.av;
+			this.interleaving.value=settings.et;
+			this.interleave = settings.et;
+			this.resolution.value=settings.rs;
+			this.mode = settings.am == 1 ? 1 : 0;
+			if( settings.am == 1 ){ this.peak_detect.checked="checked"; }
+			else { this.peak_detect.checked=""; }
+			if( settings.am == 2 ){ this.roll.checked="checked"; }
+			else { this.roll.checked=""; }
+			this.rolling = settings.am == 2;
 			this.trigger_level.value=settings.tl;
 			if( settings.tf & 1 ){ this.trigger_on.checked="checked"; } 
 			else { this.trigger_on.checked=""; }
@@ -154,15 +203,254 @@ function apply_params()
 {
 	this.post_params();
 	if(isNaN(this.sampling_rate.value)) { return; }
+	if(isNaN(this.record_length.value)) { return; }
+	if(isNaN(this.decimation.value)) { return; }
+	if(isNaN(this.averaging.value)) { return; }
+	if(isNaN(this.interleaving.value)) { return; }
 	if(isNaN(this.trigger_level.value)) { return; }
 }
 
+function unpack_wide(bytes)
+{
+	/*Groups of 4 samples are packed in 5 bytes, the last one holding
+	the 2 least significant bits of each sample.*/
+	var sample = new Uint16Array(Math.floor(bytes.length / 5) * 4);
+	for(var i = 0; i < sample.length; ++i)
+	{
+		var group = Math.floor(i / 4) * 5;
+		var low = bytes[group + 4] >> ((i % 4) * 2);
+		sample[i] = (bytes[group + i % 4] << 2) | (low & 3);
+	}
+	return sample;
+}
+
+function delta_decode(bytes)
+{
+	/*The first sample is on two bytes, followed by zig-zag coded deltas
+	(see delta_frame_file.h).*/
+	if(bytes.length < 2){ return []; }
+	var sample = [(bytes[0] << 8) | bytes[1]];
+	var delta = 0;
+	function unzigzag(z){ return (z >> 1) ^ -(z & 1); }
+	function push(){ sample.push(sample[sample.length - 1] + delta); }
+	for(var i = 2; i < bytes.length; )
+	{
+		var token = bytes[i++];
+		if(token < 0x40)
+		{
+			delta = unzigzag(token >> 3); push();
+			delta = unzigzag(token & 7); push();
+		}
+		else if(token < 0x80)
+		{
+			for(var j = 0; j <= (token & 0x3F); ++j){ push(); }
+		}
+		else if(token < 0xFF)
+		{
+			delta = unzigzag(token - 0x80); push();
+		}
+		else
+		{
+			delta = unzigzag((bytes[i] << 8) | bytes[i + 1]); push();
+			i += 2;
+		}
+	}
+	return sample;
+}
+
+/*The length of the metadata sent before every frame (see frame_header_file.h).*/
+var FRAME_HEADER_LENGTH = 18;
+
+function parse_header(bytes)
+{
+	/*Multi-byte fields are little-endian.*/
+	function word(i){ return bytes[i] | (bytes[i + 1] << 8); }
+	return {
+		version: bytes[0],
+		channel: bytes[1],
+		flags: bytes[2],
+		resolution: bytes[3],
+		sequence: word(4),
+		timestamp: word(6) + word(8) * 65536,
+		rate: word(10) + word(12) * 65536,
+		record_length: bytes[14],
+		trigger: bytes[15],
+		dropped: word(16)
+	};
+}
+
+function frame_length(header)
+{
+	/*Samples are packed 4 in 5 bytes in 10 bits.*/
+	if(header.resolution == 10)
+	{
+		return FRAME_HEADER_LENGTH + Math.floor(header.record_length / 4) * 5;
+	}
+	return FRAME_HEADER_LENGTH + header.record_length;
+}
+
+function decode_samples(header, bytes)
+{
+	if(header.flags & 1)
+	{
+		return delta_decode(bytes);
+	}
+	if(header.resolution == 10)
+	{
+		return unpack_wide(bytes);
+	}
+	return bytes;
+}
+
+function decode_frame(bytes)
+{
+	if(bytes.length < FRAME_HEADER_LENGTH){ return; }
+	var header = parse_header(bytes);
+	bytes = bytes.subarray(FRAME_HEADER_LENGTH);
+	if(header.rate != this.rate || header.resolution != this.sample_resolution)
+	{
+		this.rate = header.rate;
+		this.sample_resolution = header.resolution;
+		this.update_scale();
+	}
+	this.mode = header.flags & 2 ? 1 : 0; /*Pairs of peaks.*/
+	this.trigger_index = header.trigger;
+	this.dropped = header.dropped;
+	this.sample = decode_samples(header, bytes);
+	this.sampling_size = this.sample.length;
+	this.display.request_draw();
+}
+
+function get_roll()
+{
+	this.ajax_sample = new XMLHttpRequest();
+	hdl = this;
+	this.ajax_sample.onreadystatechange=function(){ hdl.rec_roll(); }
+	/*Only the samples acquired since the last ones received are sent, the
+	whole history if there are none yet.*/
+	var url = "/ch" + this.number + "/roll";
+	if(this.roll_index !== ""){ url += "?from=" + this.roll_index; }
+	this.ajax_sample.open("GET", url, true);
+	this.ajax_sample.responseType = "arraybuffer";
+	this.ajax_sample.send();
+}
+
+function rec_roll()
+{
+	if(this.ajax_sample.readyState==4)
+	{
+		var ok = this.ajax_sample.status==200;
+		var bytes = ok ? new Uint8Array(this.ajax_sample.response) : [];
+		if(bytes.length >= FRAME_HEADER_LENGTH)
+		{
+			var header = parse_header(bytes);
+			if(header.rate != this.rate || header.resolution != this.sample_resolution)
+			{
+				this.rate = header.rate;
+				this.sample_resolution = header.resolution;
+				this.update_scale();
+			}
+			/*The sequence number is the index of the first sample, if it is
+			not the one asked for, the history restarted or samples were missed.*/
+			var history = header.sequence == this.roll_index ? Array.from(this.sample) : [];
+			var sample = decode_samples(header, bytes.subarray(FRAME_HEADER_LENGTH));
+			for(var i = 0; i < sample.length; ++i){ history.push(sample[i]); }
+			/*The strip chart scrolls, the oldest samples fall off its left side.*/
+			var length = this.record_length.value * 1;
+			if(history.length > length){ history = history.slice(history.length - length); }
+			this.roll_index = (header.sequence + header.record_length) & 0xFFFF;
+			this.mode = 0;
+			this.trigger_index = 255; /*Roll mode does not trigger.*/
+			this.dropped = header.dropped;
+			this.sample = history;
+			this.sampling_size = history.length;
+			this.display.request_draw();
+		}
+		/*Slow signals do not need to be polled any faster.*/
+		this.timer = setTimeout(function(o){ o.get_sample(); }, ok ? 250 : 3000, this);
+	}
+}
+
+function stream_sample()
+{
+	var channel = this;
+	this.stream_buffer = new Uint8Array(0);
+	/*The chunks of the stream are read as bytes as they arrive.*/
+	fetch("/ch" + this.number + "/stream").then(function(response)
+	{
+		if(!response.ok){ throw response.status; }
+		var reader = response.body.getReader();
+		function pump()
+		{
+			return reader.read().then(function(result)
+			{
+				if(result.done){ return; }
+				channel.rec_stream(result.value);
+				return pump();
+			});
+		}
+		return pump();
+	}).then(function()
+	{
+		/*The stream has ended, reconnect right away.*/
+		channel.timer = setTimeout(function(o){ o.get_sample(); }, 0, channel);
+	}, function()
+	{
+		channel.timer = setTimeout(function(o){ o.get_sample(); }, 3000, channel);
+	});
+}
+
+function rec_stream(chunk)
+{
+	/*Frames are sent back to back as they get completed and can be split
+	across chunks, only the last complete one is drawn. Each frame's length
+	comes from its own header, not from the form.*/
+	var data = new Uint8Array(this.stream_buffer.length + chunk.length);
+	data.set(this.stream_buffer);
+	data.set(chunk, this.stream_buffer.length);
+	var start = 0, last = -1, length;
+	while(data.length - start >= FRAME_HEADER_LENGTH)
+	{
+		length = frame_length(parse_header(data.subarray(start)));
+		if(data.length - start < length){ break; }
+		last = start;
+		start += length;
+	}
+	if(last >= 0)
+	{
+		this.decode_frame(data.subarray(last, start));
+	}
+	this.stream_buffer = data.slice(start);
+}
+
 function get_sample()
 {
+	if(this.rolling)
+	{
+		this.get_roll();
+		return;
+	}
+	this.roll_index = ""; /*The history is sent again when rolling resumes.*/
+	if(!this.compressed.checked)
+	{
+		/*Frames are pushed by the oscilloscope as they get completed.*/
+		this.stream_sample();
+		return;
+	}
 	this.ajax_sample = new XMLHttpRequest();
 	hdl = this;
 	this.ajax_sample.onreadystatechange=function(){ hdl.rec_sample(); }
-	this.ajax_sample.open("GET", "/ch" + this.number, true);
+	/*The oscilloscope holds the request until there is a frame newer than the
+	last one received.*/
+	var url = "/ch" + this.number + "?since=" + this.sequence;
+	/*The frame is decoded according to what was requested.*/
+	this.ajax_sample.compressed = this.compressed.checked;
+	if(this.ajax_sample.compressed)
+	{
+		url += "&ec=delta";
+	}
+	this.ajax_sample.open("GET", url, true);
+	this.ajax_sample.responseType = "arraybuffer";
 	this.ajax_sample.send();
 }
 
@@ -170,33 +458,55 @@ function rec_sample()
 {
 	if(this.ajax_sample.readyState==4)
 	{
-		if(this.ajax_sample.status==200 || this.ajax_sample.status==304)
+		if(this.ajax_sample.status==200)
 		{
-			this.sample = [];
-			this.sampling_size = this.ajax_sample.responseText.length; 
-			for(i = 0; i < this.sampling_size; ++i)
+			/*The entity tag is the sequence number of the frame.*/
+			var etag = this.ajax_sample.getResponseHeader("ETag");
+			if(etag)
 			{
-				this.sample[i] = this.ajax_sample.responseText[i].charCodeAt() & 0x00FF;
+				this.sequence = parseInt(etag.replace(/"/g, ""));
 			}
-			this.display.draw(this);
+			this.decode_frame(new Uint8Array(this.ajax_sample.response));
 		}
-		this.timer = setTimeout(function(o){ o.get_sample(); }, 3000, this);
+		/*Ask for the next frame right away, unless there was an error. A 304
+		means no new frame was acquired in time.*/
+		var ok = this.ajax_sample.status==200 || this.ajax_sample.status==304;
+		this.timer = setTimeout(function(o){ o.get_sample(); }, ok ? 0 : 3000, this);
 	}
 }
 function get_style()
 {
-	var style = { "color": this.color.value, "line_style": "" };
+	var style = { "color": this.color.value, "width": 2, "dash": [] };
 	
 	switch(this.line_style.value)
 	{
-		case "dashed": style.line_style = "stroke-dasharray: 4,4"; break;
-		case "bold": style.line_style = "stroke-width:4;"; break;
+		case "dashed": style.dash = [4, 4]; break;
+		case "bold": style.width = 4; break;
 		default:
 	}
 	
 	return style;
 }
 
+function style_change()
+{
+	this.style = this.get_style();
+	this.display.request_draw();
+}
+
+function update_scale()
+{
+	/*Pixels per sample horizontally and per ADC unit vertically, from the
+	center of the display.*/
+	var ppt = DISPLAY_SIZE / (this.tdiv * DIVISIONS);
+	var ppv = DISPLAY_SIZE / (this.vdiv * DIVISIONS);
+	this.scale = {
+		"x": ppt * 1000 / this.rate, /*The rate is in millihertz.*/
+		"y": ADC_MAX * ppv / (1 << this.sample_resolution),
+		"offset": DISPLAY_SIZE / 2
+	};
+}
+
 function vdiv_change()
 {
 	var val = this.vdivctl.value;
@@ -208,7 +518,8 @@ function vdiv_change()
 		case "mV" : this.vdiv /= 1000; break;
 		default:
 	}
-	this.display.draw(this);
+	this.update_scale();
+	this.display.request_draw();
 }
 
 function tdiv_change()
@@ -221,7 +532,8 @@ function tdiv_change()
 		case "uS" : this.tdiv /= 1000000; break;
 		default:
 	}
-	this.display.draw(this);
+	this.update_scale();
+	this.display.request_draw();
 }
 
 function Channel(number, control, display)
@@ -231,12 +543,18 @@ function Channel(number, control, display)
 	this.rec_params= rec_params;
 	this.get_sample = get_sample;
 	this.rec_sample = rec_sample;
+	this.stream_sample = stream_sample;
+	this.rec_stream = rec_stream;
+	this.decode_frame = decode_frame;
+	this.get_roll = get_roll;
+	this.rec_roll = rec_roll;
 	this.apply_params = apply_params;
 	this.display = display;
 	this.vdiv_change = vdiv_change;
 	this.tdiv_change = tdiv_change;
 	this.get_style = get_style;
-	this.timer = setTimeout( this.get_sample(), 1000 * Math.random()); /*Does not work with IE (http://klevo.sk/javascript/javascripts-settimeout-and-how-to-use-it-with-your-methods/)*/
+	this.style_change = style_change;
+	this.update_scale = update_scale;
 	this.empty = true;
 	this.control = control;
 	this.vdivctl = control.children["vdiv"];
@@ -250,11 +568,28 @@ function Channel(number, control, display)
 	this.tdivunit = control.children["tdivunit"];
 	this.tdivunit.addEventListener('change', function(){ channels[number - 1].tdiv_change(); }, false);
 	this.sample = [];
+	this.sequence = ""; /*No frame was received yet, any will do.*/
+	this.rate = 1000;
+	this.sample_resolution = 8;
+	this.update_scale();
 	/*for(i = 0; i < 200; i += 1)
 	{
 		this.sample.push(Math.floor(Math.random()*201));
 	}*/
+	this.enabled = control.children["enabled"];
 	this.sampling_rate = control.children["sampling_rate"];
+	this.record_length = control.children["record_length"];
+	this.decimation = control.children["decimation"];
+	this.averaging = control.children["averaging"];
+	this.interleaving = control.children["interleaving"];
+	this.interleave = 1;
+	this.resolution = control.children["resolution"];
+	this.compressed = control.children["compressed"];
+	this.peak_detect = control.children["peak_detect"];
+	this.roll = control.children["roll"];
+	this.rolling = false;
+	this.roll_index = "";
+	this.mode = 0;
 	this.sampling_size = 0;
 	this.trigger_level = control.children["trigger_level"];
 	this.trigger_on = control.children["trigger_on"];
@@ -262,7 +597,13 @@ function Channel(number, control, display)
 	this.trigger_down = control.children["trigger_down"];
 	this.control.children["apply"].addEventListener('click', function(){ channels[number - 1].apply_params(); }, false);
 	this.color = control.children["style_menu"].children["color"] ;
+	this.color.addEventListener('change', function(){ channels[number - 1].style_change(); }, false);
 	this.line_style = control.children["style_menu"].children["line_style"];
+	this.line_style.addEventListener('change', function(){ channels[number - 1].style_change(); }, false);
+	this.style = this.get_style();
+	display.channels.push(this);
+	/*Wait for the parameters before getting samples, the frame length depends on them.*/
+	this.timer = setTimeout(function(o){ o.get_sample(); }, 1000 * Math.random(), this); /*Does not work with IE (http://klevo.sk/javascript/javascripts-settimeout-and-how-to-use-it-with-your-methods/)*/
 	
 	this.post_params();
 }
@@ -271,10 +612,43 @@ var display;
 var channels = [];
 
 
+/*Create a view for each channel of the oscilloscope, the page only has the first two.*/
+function create_channels(count)
+{
+	var container = document.getElementById("channels");
+	var i;
+	for(i = 1; i <= count; i++)
+	{
+		var control = document.getElementById("channel" + i);
+		if(!control)
+		{
+			control = document.getElementById("channel1").cloneNode(true);
+			control.id = "channel" + i;
+			control.querySelector(".name").textContent = "Channel " + i;
+			container.appendChild(control);
+		}
+		channels.push( new Channel(i, control, display) );
+	}
+	/*Remove the views of channels the oscilloscope does not have.*/
+	for(var control; (control = document.getElementById("channel" + i)); i++)
+	{
+		container.removeChild(control);
+	}
+}
+
 window.onload = function ()
 {
-	 display = new Display(document.getElementById("display"));
+	 display = new Display(document.getElementById("display"), document.getElementById("waveforms"));
 	 display.draw_grid();
-	 channels.push( new Channel(1, document.getElementById("channel1"), display) );
-	 channels.push( new Channel(2, document.getElementById("channel2"), display) );
+	 /*The number of channels is in the parameters of the acquisition.*/
+	 var ajax = new XMLHttpRequest();
+	 ajax.onreadystatechange = function()
+	 {
+		if(ajax.readyState == 4)
+		{
+			create_channels(ajax.status == 200 ? JSON.parse(ajax.responseText).ch : 2);
+		}
+	 }
+	 ajax.open("GET", "/all/pr", true);
+	 ajax.send();
 }
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+# make_assets.py - Generates the program memory mirror of the web assets
+# Copyright (C) 2011 Antoine Mercier-Linteau
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Compresses the web assets with gzip and writes them as program memory
+arrays in web_assets.h, served by the Assets resource (see assets.h).
+
+The page is revalidated on every load, while the script and the style sheet
+are cached for good: the page refers to them with their entity tag in the
+query string, so a new version of the firmware gets them loaded again.
+
+Run it from the root of the repository after changing a file in web/:
+    python3 web/make_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+
+WEB = os.path.dirname(os.path.abspath(__file__))
+OUTPUT = os.path.join(WEB, "..", "web_assets.h")
+
+# The assets mirrored in program memory, with the type each is served as.
+# The page must come last, it refers to the others by their entity tag.
+ASSETS = [
+	("main.css", "ASSET_CSS"),
+	("main.js", "ASSET_JAVASCRIPT"),
+	("main.xhtml", "ASSET_XHTML"),
+]
+
+HEADER = """/* web_assets.h - The web assets mirrored in program memory
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Generated by web/make_assets.py, do not edit. It is only included by
+ * assets.cpp. */
+
+#ifndef WEB_ASSETS_H_
+#define WEB_ASSETS_H_
+
+"""
+
+
+def symbol(name):
+	return name.replace(".", "_")
+
+
+def main():
+	tags = {}
+	out = [HEADER]
+	table = []
+	total = 0
+
+	for name, kind in ASSETS:
+		with open(os.path.join(WEB, name), "rb") as f:
+			content = f.read()
+
+		# Make the page load the current version of the other assets.
+		for other, tag in tags.items():
+			content = content.replace(
+				('"%s"' % other).encode(),
+				('"%s?v=%s"' % (other, tag)).encode())
+
+		# Without a timestamp, the same content always compresses the same.
+		data = gzip.compress(content, 9, mtime=0)
+		tag = hashlib.sha1(data).hexdigest()[:8]
+		tags[name] = tag
+		total += len(data)
+
+		out.append("/// %s, %d bytes compressed from %d.\n" %
+			(name, len(data), len(content)))
+		out.append("static const uint8_t %s_P[] PROGMEM =\n{" % symbol(name))
+
+		for i in range(0, len(data), 16):
+			out.append("\n\t" + ", ".join("0x%02X" % b for b in data[i:i + 16]) +
+				",")
+
+		out.append("\n};\n\n")
+		out.append('static const char %s_name_P[] PROGMEM = "%s";\n' %
+			(symbol(name), name))
+		# The tag stays in RAM, responses keep a pointer to their headers.
+		out.append('static const char %s_etag[] = "\\"%s\\"";\n\n' %
+			(symbol(name), tag))
+
+		table.append("\t{ %s_name_P, %s_P, sizeof(%s_P), %s_etag, %s },\n" %
+			((symbol(name),) * 4 + (kind,)))
+
+	out.append("/// The assets mirrored in program memory.\n")
+	out.append("static const asset_t assets_P[] PROGMEM =\n{\n")
+	out.extend(table)
+	out.append("};\n\n#endif /* WEB_ASSETS_H_ */\n")
+
+	with open(OUTPUT, "w") as f:
+		f.write("".join(out))
+
+	print("%d bytes of program memory used by the assets." % total)
+
+
+if __name__ == "__main__":
+	main()
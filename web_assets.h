@@ -0,0 +1,505 @@
+/* web_assets.h - The web assets mirrored in program memory
+ * Copyright (C) 2011 Antoine Mercier-Linteau
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Generated by web/make_assets.py, do not edit. It is only included by
+ * assets.cpp. */
+
+#ifndef WEB_ASSETS_H_
+#define WEB_ASSETS_H_
+
+/// main.css, 325 bytes compressed from 670.
+static const uint8_t main_css_P[] PROGMEM =
+{
+	0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8D, 0x52, 0xCD, 0x6A, 0xC3, 0x30,
+	0x0C, 0x3E, 0x37, 0x4F, 0x61, 0xE8, 0x65, 0x83, 0x65, 0xB4, 0x1D, 0x3B, 0xD4, 0x39, 0xED, 0x49,
+	0x86, 0x12, 0x2B, 0x89, 0xA8, 0x63, 0x05, 0x5B, 0x6D, 0xD3, 0x8D, 0xBD, 0xFB, 0xEC, 0xB8, 0xED,
+	0x28, 0xAC, 0x50, 0xF0, 0x41, 0xFE, 0xA2, 0xEF, 0x47, 0x8A, 0x6B, 0x36, 0xA7, 0xE2, 0xBB, 0x58,
+	0xB4, 0xEC, 0xA4, 0x6C, 0x61, 0x20, 0x7B, 0xD2, 0xEA, 0xC3, 0x13, 0xD8, 0xAA, 0xF8, 0x29, 0x8A,
+	0x65, 0x68, 0x3C, 0xA2, 0x4B, 0x1D, 0x23, 0x07, 0x12, 0x62, 0xA7, 0x95, 0x47, 0x0B, 0x42, 0x07,
+	0xAC, 0x22, 0xCD, 0x32, 0x88, 0x56, 0x16, 0x5B, 0xC9, 0xFD, 0x86, 0xC2, 0x68, 0x61, 0x96, 0x3C,
+	0x97, 0x5A, 0xD5, 0x96, 0x9B, 0x5D, 0x6C, 0xAE, 0xD9, 0x1B, 0xF4, 0x5A, 0x6D, 0xC6, 0x49, 0x05,
+	0xB6, 0x64, 0x22, 0x76, 0x24, 0x23, 0xBD, 0x56, 0xEF, 0xAB, 0xD5, 0x38, 0xC5, 0x6B, 0x8F, 0xD4,
+	0xF5, 0x72, 0xBD, 0x27, 0xC5, 0x23, 0x1C, 0xB0, 0x65, 0x3F, 0x84, 0xDB, 0x10, 0x50, 0x47, 0x89,
+	0xBD, 0xA4, 0x10, 0xC9, 0x7D, 0x56, 0x8D, 0xB5, 0xF0, 0x78, 0x2E, 0x23, 0xF7, 0x15, 0x26, 0x9A,
+	0x69, 0x41, 0x3C, 0xEF, 0x50, 0xFB, 0xAE, 0x7E, 0xDA, 0x6E, 0x5F, 0xE6, 0xF3, 0x5C, 0x5D, 0xE0,
+	0x32, 0x67, 0x78, 0xCB, 0x94, 0xCE, 0x93, 0x79, 0x94, 0xB2, 0xCE, 0x94, 0x01, 0xFC, 0xEE, 0x51,
+	0xCA, 0x26, 0x0F, 0xD5, 0xF4, 0xE0, 0x1C, 0xDA, 0x39, 0xDC, 0x7F, 0x6B, 0xB9, 0xD9, 0xEB, 0x22,
+	0x1A, 0x74, 0xE4, 0xCA, 0x3C, 0xE7, 0x1A, 0x87, 0x6C, 0xEB, 0x60, 0xC0, 0xC4, 0x17, 0x9C, 0xA4,
+	0x04, 0x4B, 0x5D, 0xDC, 0x4A, 0x83, 0x4E, 0xD0, 0xE7, 0xEF, 0x67, 0x8F, 0x7B, 0x16, 0x23, 0x18,
+	0x43, 0xAE, 0xBB, 0x2C, 0x2E, 0x7B, 0xFC, 0xED, 0x6E, 0x19, 0xE4, 0x64, 0x93, 0xFE, 0xB5, 0xFE,
+	0x1C, 0xD0, 0xED, 0xCF, 0x40, 0xCB, 0x1C, 0x7D, 0x92, 0x74, 0x63, 0x11, 0xA2, 0x72, 0xCD, 0xD2,
+	0x67, 0x9E, 0x78, 0x70, 0x81, 0x82, 0x80, 0xBF, 0xBE, 0xAB, 0x99, 0xAE, 0x15, 0x49, 0x4C, 0xD9,
+	0x54, 0x17, 0x90, 0xBE, 0x22, 0xB6, 0x4E, 0xFF, 0x59, 0xDD, 0x1B, 0xE2, 0x17, 0x11, 0x09, 0x49,
+	0x6E, 0x9E, 0x02, 0x00, 0x00,
+};
+
+static const char main_css_name_P[] PROGMEM = "main.css";
+static const char main_css_etag[] = "\"a377ba08\"";
+
+/// main.js, 5622 bytes compressed from 18883.
+static const uint8_t main_js_P[] PROGMEM =
+{
+	0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xC5, 0x3C, 0xFD, 0x77, 0x13, 0x39,
+	0x92, 0x3F, 0x3B, 0x7F, 0x85, 0xE8, 0xF7, 0x86, 0xB1, 0x13, 0xC7, 0x76, 0x4C, 0xC2, 0x71, 0x18,
+	0xC3, 0xCB, 0x42, 0x18, 0xD8, 0x07, 0x0C, 0x8F, 0x70, 0xB3, 0x7B, 0xC7, 0xCB, 0xE5, 0x29, 0x6E,
+	0xD9, 0x6E, 0xD2, 0xEE, 0xF6, 0x76, 0xCB, 0x76, 0x02, 0x93, 0xFF, 0x7D, 0xAB, 0x4A, 0xDF, 0xDD,
+	0xED, 0x10, 0x86, 0x99, 0xBB, 0x7D, 0xBB, 0x8B, 0x5B, 0x2A, 0x49, 0xA5, 0xAA, 0x52, 0x7D, 0xA9,
+	0x94, 0x9D, 0xFE, 0xEE, 0x8B, 0xA4, 0x5C, 0xA6, 0xFC, 0x9A, 0x4D, 0x52, 0x5E, 0x96, 0xBB, 0xFD,
+	0x9D, 0x9D, 0xE9, 0x2A, 0x9B, 0xC8, 0x24, 0xCF, 0xD8, 0xA4, 0x10, 0x5C, 0x8A, 0xF3, 0x34, 0xC9,
+	0x44, 0x9B, 0x4B, 0x59, 0x94, 0x9D, 0x9D, 0xAF, 0x3B, 0xAD, 0x35, 0x2F, 0x18, 0x36, 0xB1, 0x31,
+	0x8B, 0xF3, 0xC9, 0x6A, 0x21, 0x32, 0xD9, 0x53, 0x90, 0x27, 0xA9, 0xC0, 0xAF, 0x77, 0xA7, 0x6D,
+	0x39, 0x4F, 0xCA, 0x5E, 0xB9, 0x9E, 0xBD, 0x3B, 0xED, 0xB2, 0x08, 0xFE, 0x7D, 0x8C, 0x03, 0x22,
+	0xD6, 0x19, 0xB5, 0x5A, 0x6C, 0xA7, 0x35, 0xCD, 0x8B, 0x76, 0xC6, 0x17, 0x82, 0x25, 0x19, 0x53,
+	0xF3, 0x7E, 0xA5, 0x19, 0x7B, 0xA5, 0x90, 0xC7, 0xF0, 0x9D, 0x5C, 0xAC, 0xA4, 0x80, 0x59, 0xB2,
+	0x55, 0x9A, 0x76, 0x19, 0x42, 0x76, 0x15, 0xDC, 0x27, 0xFC, 0x7D, 0xD6, 0x19, 0xB1, 0x9B, 0x9D,
+	0x16, 0x2D, 0xC1, 0x61, 0xDD, 0x1E, 0x5F, 0x2E, 0x45, 0x16, 0x3F, 0x9F, 0x27, 0x69, 0xDC, 0xC6,
+	0x69, 0x60, 0x95, 0x9D, 0x1B, 0x6F, 0x1B, 0x71, 0xC1, 0x37, 0xE7, 0xB3, 0x22, 0x89, 0xDB, 0x84,
+	0x3F, 0xAE, 0x9E, 0x00, 0xF2, 0x07, 0xC3, 0xDE, 0xD1, 0x88, 0x25, 0xEC, 0x09, 0x3B, 0x18, 0x0C,
+	0xF0, 0xC7, 0x9E, 0x6A, 0xEB, 0xEC, 0xB4, 0x00, 0xAA, 0x95, 0x4C, 0xDB, 0xC9, 0x78, 0x7C, 0x34,
+	0x00, 0xDC, 0x26, 0x79, 0x26, 0x93, 0x6C, 0x25, 0x68, 0xDD, 0x56, 0x7F, 0xF7, 0x37, 0x51, 0xC8,
+	0x64, 0xC2, 0x53, 0x20, 0x56, 0x4B, 0xE1, 0xE1, 0x53, 0xEA, 0x2B, 0x8B, 0x88, 0x94, 0xD1, 0x63,
+	0x16, 0xE1, 0xAA, 0x51, 0x17, 0xB6, 0xDC, 0x6A, 0x45, 0x57, 0x07, 0xD0, 0x02, 0xAB, 0xB0, 0xE8,
+	0xA7, 0xA8, 0x4B, 0x2D, 0xD7, 0xD8, 0x32, 0x50, 0xBF, 0xAF, 0x86, 0xB5, 0x5E, 0x6C, 0x89, 0x00,
+	0xB7, 0x9F, 0x22, 0x76, 0xD3, 0x19, 0xD1, 0xCA, 0xAF, 0xF2, 0x22, 0xF9, 0x02, 0xD8, 0xFC, 0xA1,
+	0xB5, 0x07, 0xDE, 0xAA, 0xC1, 0x4A, 0x57, 0x6E, 0x25, 0x6F, 0x69, 0x0D, 0xA2, 0xD6, 0x86, 0x8D,
+	0x3B, 0xCA, 0x35, 0x10, 0x2E, 0xA4, 0xDB, 0x4F, 0x48, 0x47, 0x36, 0x1E, 0xB3, 0x1F, 0xA3, 0xDE,
+	0x82, 0x17, 0x97, 0xDF, 0xA0, 0x5E, 0x74, 0xF8, 0x9F, 0xC1, 0x2E, 0x1A, 0x28, 0x78, 0x74, 0xF0,
+	0x07, 0x09, 0x58, 0x5B, 0xDE, 0x5B, 0x6C, 0x1B, 0x11, 0x71, 0xB1, 0xED, 0x34, 0x04, 0xA9, 0xEC,
+	0xEF, 0x7E, 0x9C, 0x0B, 0x56, 0x26, 0x5F, 0x04, 0xCB, 0xA7, 0x4C, 0xC2, 0xEF, 0x58, 0x9F, 0x3F,
+	0x38, 0x0C, 0xCB, 0xE4, 0x4A, 0xA4, 0x25, 0xE3, 0x59, 0x4C, 0x3D, 0xD9, 0x6A, 0x71, 0x21, 0x0A,
+	0x84, 0x8B, 0x93, 0x75, 0x52, 0x82, 0x2C, 0x43, 0xDF, 0xA4, 0xC8, 0xCB, 0x92, 0x25, 0xB2, 0x07,
+	0x1B, 0xC0, 0xA3, 0xF8, 0xE2, 0xF5, 0xE9, 0xFB, 0x37, 0xC7, 0xFF, 0x7D, 0x7E, 0xFA, 0xFA, 0x7F,
+	0x4E, 0x80, 0x37, 0x47, 0xC0, 0x12, 0xDD, 0xFE, 0xDB, 0xEB, 0xD3, 0xD7, 0xBF, 0xBE, 0x3B, 0x85,
+	0xC6, 0x47, 0x23, 0xBD, 0xEE, 0x3A, 0x4F, 0x25, 0x9F, 0xD9, 0xA5, 0xE7, 0xC9, 0x6C, 0x2E, 0x4A,
+	0xC9, 0x8E, 0x5F, 0x3C, 0x67, 0x6B, 0x9E, 0xAE, 0x84, 0x99, 0x14, 0x1A, 0xCE, 0xDF, 0x1E, 0xFF,
+	0x13, 0xE7, 0x1B, 0x55, 0x4E, 0x52, 0x7B, 0x32, 0xE7, 0x59, 0x26, 0x52, 0x3A, 0x4B, 0xC0, 0x6C,
+	0xFD, 0xD9, 0x2B, 0xF9, 0x62, 0x09, 0x24, 0x9C, 0x9D, 0xD3, 0xDE, 0x9E, 0xB0, 0x21, 0xB0, 0xBE,
+	0x10, 0x72, 0x55, 0x64, 0xC4, 0xF8, 0x9D, 0x96, 0xDE, 0x39, 0x70, 0x1E, 0xA0, 0x58, 0x9E, 0xA5,
+	0xA0, 0x72, 0x60, 0xEC, 0x4C, 0x94, 0x6C, 0x93, 0xC8, 0x39, 0x21, 0x04, 0x0A, 0x00, 0x64, 0x65,
+	0x56, 0x76, 0x61, 0x83, 0x2C, 0x29, 0x41, 0x76, 0x16, 0x4B, 0xD0, 0x05, 0x31, 0xBB, 0x10, 0x20,
+	0x7C, 0x02, 0xC0, 0xE3, 0x9D, 0x56, 0xBB, 0x14, 0x82, 0xAD, 0x96, 0x31, 0x32, 0x0D, 0xA7, 0x13,
+	0x1D, 0x44, 0x9B, 0xF4, 0x12, 0x7D, 0x02, 0xD6, 0x16, 0x29, 0xFC, 0x1E, 0xE9, 0x3E, 0x44, 0x30,
+	0xE8, 0xA4, 0x06, 0xDD, 0xBB, 0xE4, 0x80, 0xC2, 0x98, 0x65, 0x62, 0xC3, 0xDE, 0xC3, 0xCF, 0xE1,
+	0x8B, 0x76, 0x47, 0xF7, 0xA0, 0xFC, 0x8A, 0x2B, 0x09, 0x9D, 0x4A, 0x5A, 0xD4, 0xE7, 0x08, 0xB7,
+	0xA4, 0x7F, 0xF7, 0x4A, 0x59, 0xE4, 0x97, 0xE2, 0x54, 0x5E, 0x87, 0xF3, 0xE3, 0x37, 0xC0, 0xA7,
+	0x79, 0x31, 0x72, 0xB0, 0x28, 0x66, 0xFF, 0x48, 0x62, 0x5A, 0x2D, 0x84, 0xDC, 0x60, 0xAB, 0x07,
+	0x09, 0xC4, 0x78, 0x03, 0xC0, 0x2F, 0x78, 0x39, 0x6F, 0x87, 0x90, 0x31, 0x34, 0x75, 0x08, 0x03,
+	0x8F, 0x01, 0x8B, 0x3C, 0x16, 0x78, 0xE6, 0x0E, 0xD8, 0xFD, 0xFB, 0xAC, 0x99, 0x2B, 0x4F, 0xD9,
+	0x03, 0x7D, 0x4A, 0xFB, 0xBB, 0xA7, 0xB4, 0x7B, 0x10, 0xA8, 0x42, 0xC0, 0xE6, 0x93, 0xA2, 0x44,
+	0xA1, 0x58, 0x0A, 0x7E, 0x09, 0xC4, 0x47, 0x56, 0x88, 0x6C, 0x2D, 0xD2, 0x7C, 0x29, 0xD8, 0x2C,
+	0x07, 0x28, 0xA0, 0xFE, 0x86, 0x17, 0x31, 0xE3, 0x69, 0x0E, 0xCC, 0xF3, 0x64, 0x07, 0xE6, 0xCA,
+	0x33, 0xA1, 0x64, 0x16, 0xB8, 0x05, 0xBF, 0x2E, 0xF8, 0xE4, 0xD2, 0x83, 0x4B, 0xF3, 0x0D, 0x8A,
+	0x18, 0x02, 0x11, 0x9B, 0x34, 0xB5, 0x71, 0xC1, 0x31, 0x7B, 0x0B, 0xA4, 0xEE, 0x4D, 0xD3, 0x1C,
+	0x14, 0x4B, 0x33, 0xC6, 0x7D, 0x90, 0x23, 0x3C, 0xB9, 0xC8, 0x1E, 0xD8, 0xE1, 0x5A, 0x7C, 0xCC,
+	0xDB, 0x83, 0xAE, 0xE2, 0x73, 0x2F, 0x9F, 0x4E, 0x81, 0x46, 0x6C, 0x5F, 0xB3, 0xF6, 0xD3, 0xC1,
+	0x19, 0xDB, 0xD5, 0x5D, 0xD7, 0x34, 0x0A, 0x15, 0x16, 0x2E, 0x47, 0xEA, 0x5E, 0xA9, 0x2C, 0x5A,
+	0xD9, 0x68, 0x7B, 0x20, 0x06, 0x51, 0x43, 0x4D, 0x8F, 0x9C, 0x81, 0xE9, 0x13, 0x3B, 0xC9, 0xD5,
+	0xB6, 0x85, 0x10, 0x64, 0x08, 0x47, 0xBB, 0xB6, 0xE0, 0x4D, 0x65, 0x51, 0xB5, 0xCF, 0x7D, 0xB5,
+	0xF8, 0x53, 0xD0, 0x87, 0xF8, 0xEF, 0xFE, 0x8F, 0xAE, 0xDC, 0xB4, 0x2A, 0xCD, 0x33, 0x49, 0xF3,
+	0x52, 0xA0, 0xF8, 0x92, 0xF0, 0x5A, 0x41, 0x9A, 0x26, 0x69, 0x7A, 0xBB, 0x70, 0x5A, 0xD0, 0x59,
+	0x9A, 0x5F, 0xF0, 0xF4, 0x38, 0x5D, 0xCE, 0x39, 0x00, 0x0F, 0x7A, 0x0F, 0xAA, 0xF3, 0xB4, 0x71,
+	0xA1, 0xCE, 0xF6, 0x21, 0x07, 0xCA, 0x58, 0x80, 0x1A, 0x13, 0x4A, 0xD2, 0xEE, 0xC4, 0xB9, 0xC1,
+	0x1D, 0x38, 0xD7, 0x28, 0x20, 0x3F, 0xCC, 0xC9, 0x06, 0x5A, 0xDE, 0xD4, 0x8F, 0xB6, 0xD9, 0xB5,
+	0xEF, 0x56, 0x14, 0xE0, 0x74, 0x88, 0x42, 0xF9, 0x14, 0xA4, 0x19, 0xD0, 0x0B, 0x41, 0xD5, 0x36,
+	0x66, 0x53, 0x0E, 0xDB, 0x1F, 0xE9, 0x66, 0x33, 0xD3, 0x24, 0x15, 0xBC, 0xF8, 0x20, 0x26, 0x12,
+	0xC9, 0x00, 0xFF, 0xF5, 0x15, 0x77, 0xF8, 0x85, 0x88, 0xF8, 0x04, 0x18, 0x28, 0x02, 0xA8, 0xD9,
+	0x14, 0x15, 0xCA, 0x5E, 0x2A, 0xB2, 0x19, 0xA8, 0x0B, 0xB7, 0xFF, 0xAF, 0xC6, 0x9E, 0x91, 0x96,
+	0x0E, 0x80, 0x61, 0x9B, 0xD6, 0x00, 0x79, 0xF8, 0xFF, 0x6B, 0x05, 0x27, 0xF3, 0x9C, 0xC0, 0x69,
+	0x17, 0xFD, 0xDD, 0x7F, 0xF0, 0x35, 0x2A, 0xDA, 0x85, 0x52, 0x0B, 0x85, 0xC0, 0x3E, 0xF4, 0xD1,
+	0xD8, 0x22, 0xA7, 0x33, 0x3C, 0x01, 0x5D, 0x21, 0x50, 0xCD, 0x16, 0x42, 0xE0, 0x0C, 0xD3, 0x42,
+	0x94, 0xF3, 0x2E, 0x9B, 0xC3, 0x19, 0x5F, 0x43, 0xFB, 0x82, 0x67, 0xD7, 0x80, 0x7A, 0xC1, 0x17,
+	0xA4, 0x58, 0x8A, 0x64, 0x0D, 0xAA, 0x1B, 0xEC, 0x1A, 0xEA, 0x81, 0x85, 0xE0, 0xE0, 0x07, 0x2C,
+	0xC8, 0xC4, 0xA0, 0xDA, 0xF2, 0x49, 0x16, 0x9A, 0x8A, 0x0A, 0x31, 0x65, 0xB1, 0x32, 0x4A, 0xDA,
+	0x98, 0x4A, 0xA5, 0x8A, 0xA1, 0x71, 0x93, 0x64, 0x71, 0xBE, 0xE9, 0xE9, 0xAD, 0x1C, 0x67, 0xC9,
+	0x82, 0xE3, 0xDE, 0x5E, 0x22, 0x06, 0x6D, 0xB3, 0xD3, 0x36, 0x4C, 0xAF, 0x47, 0xF6, 0x0C, 0xD3,
+	0x46, 0x64, 0x92, 0x7D, 0x72, 0x68, 0x37, 0xB8, 0x8D, 0x2E, 0x65, 0x97, 0x4D, 0x78, 0xB6, 0xE6,
+	0xA5, 0xE3, 0x2D, 0xB6, 0xC2, 0xB2, 0xF8, 0x4F, 0x85, 0xAF, 0x78, 0xA6, 0x08, 0xB8, 0x37, 0x13,
+	0xF2, 0xB9, 0x6A, 0x6B, 0x47, 0xC3, 0x38, 0xEA, 0x58, 0x40, 0xCD, 0x05, 0x80, 0xFC, 0x74, 0x36,
+	0xBA, 0x5D, 0x58, 0xAC, 0xAF, 0x8A, 0xDE, 0xB5, 0xF9, 0xED, 0x77, 0xEA, 0x76, 0xD3, 0xA4, 0xF6,
+	0x03, 0x8D, 0xEA, 0x87, 0x6B, 0x76, 0xBC, 0xA5, 0x4E, 0xF7, 0x69, 0xB1, 0x72, 0x5E, 0x0F, 0x6E,
+	0xC1, 0x7D, 0x19, 0x00, 0x72, 0xDF, 0xA1, 0x2B, 0x9A, 0x4B, 0xB9, 0x7C, 0xDC, 0xEF, 0x6F, 0x36,
+	0x9B, 0xDE, 0xE6, 0x41, 0x2F, 0x2F, 0x66, 0xFD, 0xE1, 0x60, 0x30, 0xE8, 0x43, 0x7F, 0x44, 0x24,
+	0x44, 0xCE, 0xCC, 0xE3, 0x74, 0xC4, 0xFA, 0xBB, 0x8C, 0xB3, 0x25, 0x28, 0x73, 0x36, 0x07, 0x1B,
+	0xD0, 0xEB, 0xF5, 0x82, 0x68, 0x62, 0x09, 0x22, 0x74, 0xBE, 0xE4, 0xC0, 0x9A, 0xD2, 0x3B, 0x34,
+	0xFC, 0x33, 0xBF, 0xD2, 0xAD, 0xDA, 0xFC, 0xFE, 0xF3, 0xED, 0x9B, 0x57, 0xB0, 0xE2, 0x07, 0x85,
+	0x33, 0x69, 0x32, 0x98, 0xDD, 0xF1, 0xBC, 0x3A, 0xAC, 0x97, 0x67, 0x80, 0x7C, 0x7C, 0x5D, 0x4A,
+	0xD8, 0x81, 0xF2, 0x28, 0xC6, 0x3E, 0xEB, 0x61, 0x30, 0xD0, 0x63, 0x62, 0x97, 0xF6, 0xA2, 0x07,
+	0x7F, 0x12, 0x60, 0x48, 0x3B, 0x7A, 0xFF, 0xEB, 0xE9, 0x47, 0x70, 0xF9, 0xA2, 0xFE, 0x64, 0x1E,
+	0x81, 0x7E, 0x27, 0x28, 0xED, 0x85, 0x81, 0x23, 0xD7, 0x5F, 0x16, 0xD0, 0x89, 0xF2, 0x68, 0x7C,
+	0x03, 0xE3, 0xAF, 0x20, 0x99, 0x80, 0x18, 0x56, 0xAE, 0xC5, 0x62, 0x29, 0xAF, 0xFD, 0x33, 0xE9,
+	0x2F, 0x55, 0x02, 0xAB, 0x94, 0x82, 0xD6, 0x42, 0x4F, 0x2A, 0x07, 0xA7, 0x83, 0xD0, 0x67, 0x36,
+	0x13, 0xC5, 0xF9, 0x34, 0xE5, 0x34, 0xE7, 0xC0, 0x9B, 0xD2, 0xF4, 0xE5, 0x19, 0x08, 0x94, 0x98,
+	0x5C, 0xC2, 0xC9, 0xBA, 0x87, 0xAB, 0x9A, 0x55, 0x82, 0xA1, 0x7B, 0x56, 0x11, 0x57, 0x87, 0xAF,
+	0x96, 0x77, 0x1B, 0x3E, 0x54, 0xC3, 0x9B, 0x91, 0x8F, 0x44, 0x36, 0x8E, 0xF6, 0xF4, 0x56, 0x33,
+	0x7E, 0x91, 0x8A, 0xD8, 0xCE, 0xFA, 0x0C, 0x1C, 0x10, 0x88, 0x35, 0x3A, 0x7B, 0xD1, 0xFD, 0xB2,
+	0x00, 0x28, 0x25, 0x4B, 0x46, 0x67, 0x17, 0xC0, 0xA3, 0x1E, 0xB9, 0x9A, 0xD0, 0x5F, 0xA4, 0xA6,
+	0x1F, 0xF8, 0x93, 0x17, 0xF1, 0xB9, 0xD2, 0x69, 0xB6, 0x3F, 0x9E, 0x98, 0xFE, 0x58, 0x4C, 0xF4,
+	0xD1, 0xB6, 0x9D, 0x7C, 0x6D, 0x3A, 0x41, 0x67, 0x15, 0x7C, 0x06, 0xB3, 0xDB, 0x3E, 0x21, 0x4D,
+	0x5F, 0x02, 0xE7, 0xB1, 0x00, 0xC5, 0xBB, 0xF6, 0xBB, 0x8B, 0xD2, 0xAD, 0x5B, 0xE6, 0xE9, 0x2A,
+	0x9C, 0x77, 0x61, 0xB7, 0x56, 0xE4, 0x69, 0xEA, 0xED, 0x6B, 0x08, 0xFB, 0xD2, 0x67, 0x97, 0x5F,
+	0x9E, 0xC7, 0x02, 0xA4, 0x4D, 0x36, 0x6D, 0x5B, 0x4E, 0x71, 0x7A, 0x9F, 0xA0, 0xD8, 0x68, 0xF7,
+	0x6A, 0x7A, 0x52, 0x50, 0x99, 0xA9, 0x5A, 0xB6, 0x66, 0x59, 0x26, 0xC1, 0x41, 0x31, 0x3C, 0xF4,
+	0xF9, 0x40, 0x22, 0x7F, 0x8A, 0x22, 0x3F, 0x1E, 0x1F, 0xBA, 0xD0, 0xAB, 0xCE, 0x2F, 0x00, 0x59,
+	0x95, 0xE3, 0x31, 0x1C, 0x59, 0xF6, 0xFB, 0xEF, 0x6C, 0x6B, 0xFF, 0x83, 0xC1, 0xA1, 0xB5, 0xA1,
+	0x4E, 0x84, 0x3D, 0xF5, 0xD4, 0xAA, 0x0A, 0xFC, 0xDF, 0x4F, 0x7F, 0x7D, 0xD7, 0x83, 0x59, 0x4A,
+	0xD1, 0x84, 0x5D, 0xB9, 0x84, 0x68, 0x45, 0x7C, 0x04, 0x65, 0x48, 0x92, 0xDE, 0xC2, 0xFF, 0x01,
+	0x7E, 0x76, 0x02, 0x90, 0x1B, 0xE5, 0xAC, 0xC2, 0x09, 0x6D, 0x92, 0xA3, 0x71, 0xA4, 0x7F, 0x44,
+	0x2A, 0x6E, 0x24, 0x8F, 0x82, 0x6D, 0x83, 0x35, 0x40, 0xDB, 0x84, 0x6D, 0x6C, 0x97, 0x2D, 0xC9,
+	0xDD, 0x69, 0x6D, 0x93, 0x3A, 0x07, 0x58, 0xA4, 0x0E, 0xB0, 0x2A, 0x7E, 0x0E, 0x2A, 0x9E, 0x38,
+	0xA8, 0x8A, 0x1C, 0x3A, 0x20, 0xBE, 0x76, 0x40, 0x75, 0x81, 0x74, 0x70, 0x42, 0x36, 0xC0, 0xA1,
+	0x76, 0x6E, 0x84, 0xA8, 0xCA, 0xAE, 0x87, 0x7A, 0xE9, 0xA0, 0x54, 0x54, 0xE0, 0x66, 0xE0, 0x0B,
+	0x45, 0x76, 0x2D, 0xAF, 0xA3, 0x1A, 0x5F, 0x0C, 0x80, 0xE1, 0x4B, 0x83, 0xB0, 0xDF, 0xCA, 0x9B,
+	0x46, 0x78, 0x03, 0xD8, 0xB0, 0xD2, 0xD0, 0xAE, 0xE4, 0x1F, 0xB7, 0x5B, 0x97, 0x08, 0x01, 0x03,
+	0xDE, 0x63, 0x97, 0x32, 0xAB, 0xD5, 0x65, 0x1C, 0x49, 0x1A, 0x0E, 0xA0, 0xA3, 0x9D, 0x4C, 0xEB,
+	0x24, 0x91, 0x53, 0x76, 0xDF, 0xA3, 0x48, 0x5D, 0x13, 0x07, 0xD8, 0xB2, 0x2A, 0xBA, 0x4D, 0xF0,
+	0x8D, 0x04, 0xA1, 0x75, 0x80, 0x1E, 0xD8, 0x41, 0x07, 0xB1, 0xB5, 0x45, 0x75, 0x7B, 0xEB, 0xD5,
+	0xC1, 0xC0, 0x21, 0x0A, 0x16, 0x42, 0x08, 0x87, 0xD4, 0x1D, 0xE6, 0xFE, 0xF6, 0xA4, 0xC1, 0xEA,
+	0x34, 0xF7, 0x4D, 0xD5, 0xBB, 0xE4, 0xCB, 0x65, 0x7A, 0x5D, 0x37, 0xF7, 0x81, 0x13, 0xA0, 0xAC,
+	0x5B, 0x52, 0xBE, 0xE3, 0xEF, 0xDA, 0xDB, 0x4E, 0x6E, 0xA7, 0xC3, 0x02, 0xE7, 0x30, 0x1C, 0xD0,
+	0x70, 0x82, 0x6F, 0x1F, 0x50, 0x3D, 0xC9, 0xB7, 0x43, 0x57, 0x4E, 0xF4, 0xED, 0xC0, 0xF5, 0x93,
+	0x7D, 0x3B, 0x7C, 0x93, 0x1D, 0x08, 0x07, 0xF8, 0xF4, 0x5C, 0x65, 0x4B, 0xF0, 0xA9, 0xCE, 0x37,
+	0x49, 0x2C, 0xDA, 0x17, 0xD7, 0x52, 0x94, 0xDA, 0x63, 0xFF, 0xA5, 0xC8, 0x57, 0x4B, 0x8A, 0xDD,
+	0x0F, 0x75, 0x4C, 0x63, 0x42, 0x7A, 0x32, 0x4B, 0xE0, 0x7C, 0x1F, 0x31, 0x82, 0x57, 0x51, 0x7D,
+	0xCA, 0x55, 0x2C, 0x0E, 0x2E, 0x7B, 0x8A, 0xFE, 0x27, 0xB2, 0x45, 0x80, 0xCC, 0x01, 0xDE, 0xD0,
+	0x51, 0x26, 0xB3, 0x2C, 0x99, 0x26, 0xE0, 0xCF, 0x4A, 0x76, 0x91, 0x48, 0x9A, 0x56, 0xF0, 0xC9,
+	0x5C, 0xCF, 0xEC, 0xD2, 0x2C, 0x26, 0x95, 0x82, 0xFE, 0xDA, 0x7F, 0xC1, 0xC6, 0x0F, 0x1E, 0x1E,
+	0x17, 0x05, 0x38, 0xCF, 0x5E, 0x3C, 0x4F, 0x8B, 0xEA, 0x28, 0x05, 0xC2, 0xF8, 0xA3, 0x0E, 0x04,
+	0x5A, 0x87, 0x5B, 0x22, 0x1B, 0x3D, 0xBD, 0x09, 0x69, 0xF6, 0xF6, 0x12, 0x6D, 0xD1, 0x10, 0x6E,
+	0x86, 0x3B, 0x0C, 0x73, 0x05, 0x09, 0x4C, 0x78, 0x88, 0x13, 0x1E, 0x8D, 0x34, 0x50, 0x9A, 0xA3,
+	0x9F, 0x4B, 0x6B, 0x7E, 0x52, 0x03, 0xF6, 0xD8, 0xE1, 0x19, 0x7B, 0xFA, 0x94, 0xB5, 0x01, 0xFA,
+	0x27, 0x05, 0xAD, 0x52, 0x09, 0x2E, 0xF2, 0x1B, 0xB3, 0x76, 0x38, 0x82, 0x20, 0xCF, 0xD8, 0x13,
+	0xCC, 0x5E, 0xB1, 0xDF, 0x59, 0x1B, 0x67, 0xBD, 0xCF, 0x1E, 0xE8, 0x04, 0xA8, 0x62, 0x0C, 0x33,
+	0x69, 0xA3, 0x20, 0xC5, 0x2C, 0x52, 0xC9, 0x41, 0xEB, 0x4D, 0xF2, 0x0A, 0x7B, 0x30, 0xE5, 0x35,
+	0x4D, 0x0A, 0xA4, 0xAD, 0xA2, 0x59, 0x02, 0x44, 0x85, 0x80, 0x68, 0x93, 0x1B, 0xAE, 0x4C, 0x41,
+	0x63, 0x41, 0xF8, 0x14, 0xC3, 0x37, 0xFB, 0x92, 0xCC, 0xF6, 0xBF, 0xF0, 0x19, 0xC3, 0x69, 0x62,
+	0x35, 0x69, 0xA9, 0xF3, 0x5D, 0x6A, 0x05, 0x0A, 0xAD, 0xCE, 0x21, 0x0E, 0x17, 0xBD, 0x79, 0xC7,
+	0x44, 0x52, 0x01, 0xA5, 0xFD, 0xC4, 0x1B, 0x86, 0x1B, 0xEC, 0xA6, 0xC2, 0xB2, 0x4F, 0x7A, 0xCF,
+	0x03, 0xDA, 0xE7, 0x23, 0xDC, 0xA7, 0x6A, 0x38, 0x38, 0x3B, 0x33, 0x61, 0x16, 0xAE, 0xA5, 0xDD,
+	0x4F, 0x4F, 0x00, 0x01, 0x3B, 0x40, 0xAE, 0xFD, 0xC5, 0xCD, 0xDF, 0xFE, 0x82, 0x14, 0x3E, 0xE8,
+	0xB0, 0xFF, 0x65, 0xFB, 0xF0, 0x1B, 0x94, 0xA4, 0xF2, 0xAE, 0x9D, 0xCF, 0xBF, 0x2A, 0xE7, 0xE8,
+	0x83, 0x6B, 0x06, 0xD3, 0xA7, 0xA6, 0x7F, 0xC0, 0x73, 0x4C, 0x91, 0x9C, 0x01, 0x03, 0x68, 0x65,
+	0x3D, 0x87, 0x27, 0x26, 0x43, 0x25, 0x26, 0xFE, 0x46, 0x47, 0xCC, 0x13, 0x11, 0x09, 0x21, 0x7A,
+	0x66, 0xF9, 0x9F, 0xEC, 0xED, 0xE1, 0x4E, 0xC8, 0x1D, 0xA2, 0x8E, 0x27, 0x6C, 0x70, 0x75, 0x38,
+	0xB0, 0xEE, 0x8D, 0xD9, 0x9E, 0xDD, 0x91, 0x82, 0x7A, 0x8A, 0xD9, 0xB1, 0x91, 0x46, 0x79, 0x74,
+	0x0B, 0xE0, 0x7D, 0xF6, 0x1F, 0x01, 0x1C, 0x2A, 0x72, 0xD2, 0xF7, 0xC1, 0x82, 0x8F, 0xDC, 0x82,
+	0x66, 0x2B, 0x9F, 0x95, 0xC4, 0x7F, 0x66, 0x4F, 0x40, 0xF2, 0xCC, 0x5C, 0x83, 0xAB, 0x07, 0x2F,
+	0x3B, 0x28, 0xF3, 0x9F, 0x81, 0x4E, 0x7A, 0x52, 0xB2, 0x0D, 0xCD, 0xD3, 0xBE, 0x7C, 0xF9, 0xAD,
+	0x7D, 0xEC, 0xAB, 0xC5, 0x9B, 0x30, 0xDC, 0x3A, 0x52, 0xCB, 0x44, 0x52, 0x95, 0x89, 0x84, 0x92,
+	0x5C, 0x21, 0x55, 0x12, 0x13, 0x1E, 0xE8, 0x5C, 0x49, 0xFD, 0x58, 0x28, 0xB1, 0xD7, 0x9C, 0xD5,
+	0xA9, 0xE6, 0x85, 0x90, 0x3C, 0xE6, 0xB0, 0x2A, 0x04, 0x10, 0x52, 0xA7, 0x73, 0x19, 0x26, 0x0D,
+	0xAE, 0x19, 0x09, 0x35, 0x23, 0x29, 0x57, 0xF2, 0x3D, 0x07, 0xDF, 0x16, 0x5D, 0x67, 0x27, 0xE6,
+	0x48, 0xBD, 0x97, 0x1F, 0x8E, 0xDF, 0x9E, 0x9C, 0xBF, 0x3A, 0x39, 0x7E, 0x71, 0xF2, 0xE1, 0xFC,
+	0xCD, 0xC9, 0xBB, 0x5F, 0x3E, 0xBE, 0xC2, 0xE4, 0xD0, 0x23, 0x3F, 0x41, 0x4D, 0xEE, 0xA8, 0x1E,
+	0x1F, 0x9C, 0xC3, 0xB7, 0xAB, 0x54, 0x26, 0xFB, 0xD8, 0x02, 0xC7, 0x51, 0xA4, 0xB1, 0x52, 0x92,
+	0x69, 0x22, 0x65, 0x2A, 0xF6, 0x31, 0x14, 0xE7, 0x19, 0x1D, 0x27, 0x3B, 0xD3, 0x06, 0xEC, 0x4A,
+	0x3B, 0x71, 0xA2, 0x6E, 0x09, 0xF4, 0xBB, 0x51, 0x1A, 0x8A, 0x36, 0x8A, 0x60, 0xC4, 0x31, 0x0D,
+	0x49, 0x42, 0x29, 0x0A, 0x4C, 0xD7, 0x3F, 0x66, 0xE6, 0xAC, 0xE1, 0x9D, 0x80, 0xCE, 0x03, 0x3C,
+	0xB6, 0xE7, 0x0D, 0x1B, 0x29, 0x3E, 0x30, 0x4D, 0x43, 0x6A, 0x72, 0x8E, 0x9D, 0x69, 0x7F, 0x40,
+	0xED, 0x25, 0x46, 0xC4, 0xD9, 0x44, 0x3C, 0x56, 0xC8, 0x1D, 0x76, 0xB0, 0x11, 0x53, 0x2A, 0xE0,
+	0xC3, 0x2F, 0x96, 0xBA, 0xF5, 0x61, 0x07, 0xD0, 0xA2, 0x5F, 0x8F, 0x50, 0xE5, 0x3D, 0x3C, 0x3A,
+	0x7A, 0xF0, 0x90, 0x26, 0x05, 0x8B, 0xAA, 0x41, 0x0E, 0x06, 0x16, 0xE6, 0x60, 0x18, 0x02, 0xF9,
+	0xE6, 0xD4, 0xE2, 0x79, 0x48, 0xAB, 0x6B, 0x73, 0x65, 0x5B, 0x8F, 0xA8, 0x35, 0x2E, 0xF2, 0xE5,
+	0x52, 0xC4, 0x66, 0xE6, 0x87, 0x20, 0x9C, 0x37, 0xA1, 0x6A, 0x54, 0x2C, 0x55, 0x53, 0xB6, 0x15,
+	0x67, 0x34, 0x4F, 0x4E, 0xEB, 0xE6, 0xEA, 0xD0, 0x33, 0x58, 0xF8, 0xF3, 0x60, 0x40, 0x76, 0xC8,
+	0x68, 0x3A, 0x35, 0xDC, 0xF3, 0x7C, 0xC9, 0x55, 0x1D, 0x68, 0x4D, 0xA0, 0xE9, 0xDF, 0x24, 0x27,
+	0x7B, 0xBE, 0xF5, 0xB0, 0xB3, 0x78, 0x9B, 0xF5, 0x0D, 0x8A, 0x63, 0x65, 0xF3, 0x54, 0x4D, 0xE3,
+	0xAB, 0xE6, 0x00, 0x35, 0xF8, 0xB9, 0xB6, 0xC7, 0x7A, 0xC1, 0x2E, 0x73, 0x02, 0xE9, 0xF6, 0xA2,
+	0x02, 0xEE, 0xFB, 0x36, 0x83, 0xA7, 0x57, 0x6E, 0x30, 0x28, 0x36, 0x9E, 0xBF, 0x13, 0x15, 0xEA,
+	0xFE, 0x42, 0xB0, 0x33, 0x6A, 0x6A, 0x44, 0x9A, 0xF8, 0xD5, 0x0E, 0x50, 0xAD, 0x18, 0x98, 0x06,
+	0xAA, 0x84, 0x09, 0x3C, 0x4A, 0x08, 0x11, 0x92, 0x94, 0x02, 0xAF, 0x1D, 0x49, 0xC0, 0x44, 0x71,
+	0x58, 0x6B, 0xEC, 0x5E, 0xB9, 0xBA, 0xE0, 0xE4, 0x3F, 0x34, 0x4D, 0x3D, 0x0A, 0x36, 0x0D, 0x62,
+	0x8C, 0x89, 0x0B, 0xE5, 0xFD, 0xE1, 0x07, 0x04, 0xB5, 0x75, 0x82, 0x18, 0x08, 0xC5, 0x81, 0x73,
+	0xD7, 0xE3, 0xE7, 0x64, 0x68, 0xF8, 0x98, 0x79, 0x33, 0x8F, 0x76, 0xFC, 0x10, 0xD2, 0x1F, 0xE7,
+	0xC1, 0xD9, 0x36, 0x0B, 0xED, 0xDF, 0x45, 0xB5, 0x3B, 0x5E, 0xE2, 0x44, 0x07, 0x5F, 0x15, 0x56,
+	0x0F, 0x6D, 0xF0, 0xC5, 0xFA, 0xBB, 0xEF, 0x83, 0xAB, 0x17, 0x12, 0xF4, 0xC0, 0x3B, 0x4C, 0xB2,
+	0x58, 0x5C, 0xB9, 0x39, 0x74, 0xB3, 0xCB, 0x08, 0xD2, 0xF1, 0x73, 0xFD, 0xBA, 0xC1, 0xE6, 0xF0,
+	0x8C, 0xD5, 0xBF, 0x55, 0x22, 0x03, 0x68, 0x7B, 0xF5, 0x12, 0x90, 0xD0, 0x58, 0x5D, 0xB3, 0xAE,
+	0x4D, 0xA7, 0xFA, 0x39, 0xE4, 0x50, 0x9E, 0x66, 0x42, 0x9E, 0x63, 0x38, 0x56, 0x4D, 0xF6, 0x05,
+	0xCE, 0xE3, 0xDD, 0x93, 0x7D, 0x1A, 0x8F, 0x3B, 0x26, 0xFB, 0xD4, 0xC2, 0x24, 0x8D, 0xFD, 0xDD,
+	0x5F, 0xF1, 0xAE, 0x91, 0xAE, 0x17, 0x8D, 0xC6, 0x99, 0xFC, 0x6B, 0x95, 0x14, 0x40, 0xB7, 0x32,
+	0xC1, 0x94, 0xB6, 0xEF, 0x18, 0x97, 0x98, 0x7D, 0x11, 0x94, 0xB8, 0x46, 0xBD, 0x84, 0xD6, 0x8A,
+	0x3C, 0xE7, 0x9D, 0xD6, 0x06, 0x5C, 0x66, 0xBC, 0xF6, 0x2A, 0x65, 0x0E, 0x46, 0x2B, 0x21, 0xB3,
+	0x06, 0x10, 0x08, 0x95, 0xA1, 0x47, 0x7D, 0x2D, 0xA4, 0x75, 0x90, 0x57, 0x05, 0xEE, 0x61, 0x5B,
+	0x1A, 0x11, 0x91, 0xF3, 0xB3, 0x85, 0xF8, 0xAD, 0x19, 0x7D, 0x6F, 0x4C, 0x49, 0xB9, 0xAF, 0x34,
+	0x03, 0xD8, 0xD9, 0xE8, 0xD9, 0xB4, 0xC8, 0x17, 0x63, 0x3B, 0x8B, 0x03, 0xAD, 0xA4, 0x31, 0x0D,
+	0x79, 0x28, 0x8D, 0xF9, 0xCB, 0x09, 0x66, 0x31, 0x61, 0x0A, 0x97, 0xAD, 0xAC, 0x41, 0xDA, 0x14,
+	0xCD, 0xF5, 0x12, 0x99, 0x11, 0xD1, 0x01, 0xBC, 0x58, 0x4D, 0xA7, 0xA2, 0x88, 0x9A, 0xE0, 0x4D,
+	0xD6, 0xB2, 0x9A, 0xA8, 0x72, 0x2C, 0x0E, 0xD2, 0x4F, 0x76, 0x95, 0x7A, 0x9A, 0x0A, 0x09, 0x94,
+	0x5F, 0x1A, 0xF9, 0x0A, 0xD6, 0x70, 0xC9, 0x2A, 0xE3, 0xD8, 0x1B, 0x45, 0x01, 0x03, 0x9E, 0xD9,
+	0x70, 0xE3, 0x91, 0x8A, 0x36, 0xB6, 0xEE, 0xA9, 0x03, 0xA7, 0xEB, 0x93, 0xF1, 0x01, 0x03, 0xED,
+	0xF5, 0x74, 0xDC, 0xA8, 0xBE, 0x8C, 0x63, 0x74, 0x07, 0xCD, 0xD5, 0xFA, 0x73, 0xB5, 0x51, 0x10,
+	0x8D, 0x37, 0x6B, 0xA4, 0xEF, 0xD5, 0x49, 0xDB, 0xB4, 0x92, 0xF2, 0x03, 0xCD, 0x3D, 0xBC, 0x76,
+	0x26, 0x4C, 0x91, 0x01, 0xC4, 0x25, 0x78, 0x0C, 0x94, 0x14, 0x6A, 0x9F, 0xCD, 0x0F, 0x5C, 0xBA,
+	0x28, 0xF1, 0x74, 0x29, 0x8F, 0x73, 0x64, 0xB9, 0x24, 0x08, 0x94, 0x7B, 0x5E, 0xA2, 0xE5, 0x06,
+	0x7F, 0xAE, 0xAB, 0xEF, 0x85, 0xD5, 0x01, 0x29, 0xD0, 0x2D, 0x29, 0xF0, 0xEE, 0x3E, 0x2F, 0xEC,
+	0xC1, 0xDB, 0xE0, 0x89, 0x59, 0x24, 0x65, 0x29, 0x62, 0x75, 0x19, 0xAC, 0x28, 0xAE, 0x87, 0xD8,
+	0xFD, 0x58, 0xE4, 0xC6, 0xE3, 0xAA, 0xD8, 0x83, 0x14, 0x10, 0xF3, 0x7B, 0x78, 0x2E, 0xBC, 0xAC,
+	0x81, 0xC7, 0xF3, 0x30, 0xDE, 0xB9, 0x4D, 0xF3, 0xDD, 0x6E, 0x78, 0x14, 0xCD, 0xEE, 0x16, 0xAE,
+	0x7E, 0x35, 0x9B, 0x08, 0x62, 0x9C, 0x44, 0xD7, 0x2A, 0x59, 0xA2, 0x83, 0xFA, 0x5E, 0xE2, 0x45,
+	0x66, 0x21, 0xF1, 0x0E, 0x0D, 0x36, 0xA5, 0xC3, 0x72, 0x08, 0xC6, 0x85, 0x25, 0x75, 0x89, 0x39,
+	0xD7, 0x14, 0x98, 0x80, 0x04, 0x2F, 0xC1, 0x8F, 0x9E, 0x62, 0x64, 0x1E, 0x0B, 0x8F, 0x62, 0x5A,
+	0x9A, 0x0D, 0x75, 0xEA, 0x59, 0x10, 0x70, 0x65, 0x0E, 0xAC, 0xB0, 0x6A, 0xCC, 0xCC, 0x11, 0xD0,
+	0xA3, 0x1D, 0xCE, 0x48, 0x78, 0x0D, 0x53, 0xA6, 0xC9, 0x44, 0x54, 0x47, 0xEC, 0x9B, 0x11, 0xD5,
+	0x4C, 0x9B, 0xB5, 0x4E, 0xED, 0x2A, 0xE3, 0x9A, 0xBD, 0xA4, 0x0E, 0xC5, 0x3B, 0x2F, 0xE1, 0x3F,
+	0xB5, 0x04, 0xE5, 0xA0, 0x9E, 0x9F, 0x33, 0x93, 0x0F, 0x8F, 0x8E, 0xD0, 0x52, 0x7E, 0x80, 0x05,
+	0x19, 0x41, 0xC7, 0x58, 0x91, 0x40, 0x22, 0xA8, 0x20, 0x35, 0x61, 0xBE, 0x65, 0x11, 0x5B, 0x15,
+	0x9B, 0xA8, 0x77, 0x39, 0xAA, 0x27, 0x8E, 0xB5, 0xFD, 0x0B, 0xC9, 0xE0, 0xA5, 0x83, 0xB7, 0x58,
+	0x3F, 0x75, 0xC0, 0xC0, 0xB1, 0xC5, 0xBC, 0x01, 0xE6, 0x52, 0x78, 0x5A, 0x02, 0xB2, 0x84, 0x6A,
+	0x26, 0x00, 0x29, 0x09, 0x51, 0x3F, 0xF8, 0xBA, 0xB0, 0x11, 0x34, 0x2F, 0x19, 0x84, 0x3E, 0x60,
+	0x75, 0x0C, 0xFE, 0x6A, 0xEF, 0xE0, 0xCE, 0x17, 0x2A, 0x7B, 0xF9, 0x11, 0x7E, 0xE6, 0x2B, 0xE9,
+	0xAE, 0x31, 0x73, 0xE0, 0x58, 0x8E, 0xB7, 0x8C, 0x5A, 0x98, 0xC9, 0xBE, 0x75, 0x95, 0x66, 0x1C,
+	0x1E, 0x0D, 0x40, 0xFE, 0x1F, 0x0C, 0x06, 0x83, 0x2E, 0xC9, 0x44, 0xFD, 0xBA, 0x17, 0x64, 0x4F,
+	0xF0, 0x85, 0x1D, 0x6A, 0x2A, 0xF9, 0x74, 0x50, 0x52, 0xB1, 0xB8, 0x1A, 0x58, 0x99, 0x03, 0x2F,
+	0xCF, 0xA3, 0x15, 0xEF, 0x00, 0xA7, 0x57, 0x22, 0x3D, 0x99, 0xAF, 0xB2, 0xCB, 0xD2, 0x68, 0x0C,
+	0x35, 0x4E, 0x5F, 0x1E, 0x73, 0xD8, 0x63, 0xA9, 0x15, 0x38, 0x27, 0xF5, 0x72, 0xAD, 0x2F, 0x85,
+	0x55, 0xA8, 0x25, 0xE4, 0x64, 0xDE, 0xDE, 0x66, 0x23, 0xD5, 0x4C, 0x51, 0xA7, 0x07, 0xC3, 0x32,
+	0x47, 0x03, 0xAB, 0xE1, 0xED, 0x8D, 0xC7, 0x3D, 0xD3, 0xD4, 0xCB, 0x2F, 0x29, 0x43, 0x5B, 0x00,
+	0xF1, 0x6D, 0x9B, 0xB2, 0x28, 0x4A, 0x6E, 0x71, 0xBB, 0x85, 0x51, 0xEE, 0x16, 0xE2, 0x22, 0x8F,
+	0xAF, 0x91, 0xA8, 0x1F, 0x94, 0x9E, 0x57, 0xD5, 0x07, 0x2E, 0x7F, 0xB1, 0x58, 0xB6, 0xAD, 0x75,
+	0xD0, 0xBE, 0x73, 0x61, 0x24, 0x9B, 0x83, 0x41, 0xAC, 0xE3, 0x07, 0x91, 0xA6, 0xA7, 0xD7, 0x01,
+	0x43, 0xD5, 0xD6, 0x8B, 0x41, 0x59, 0x86, 0x7E, 0x72, 0xCB, 0xC6, 0x84, 0xE4, 0xB3, 0xA8, 0x2D,
+	0x1B, 0x70, 0x73, 0x31, 0xD4, 0x72, 0x0B, 0x2B, 0x6C, 0x94, 0x26, 0xB7, 0xE2, 0x56, 0xED, 0xBB,
+	0xA9, 0xA2, 0x64, 0x2B, 0x7E, 0x3E, 0x3A, 0x06, 0xCD, 0x81, 0x1F, 0x78, 0x61, 0x1C, 0x77, 0xD1,
+	0x86, 0xE7, 0x80, 0xC2, 0x44, 0x32, 0x38, 0x4C, 0x73, 0xC9, 0xF8, 0x06, 0x24, 0x9B, 0x04, 0xD2,
+	0xE0, 0xF6, 0x07, 0x64, 0x12, 0xA4, 0xD0, 0x94, 0x89, 0x21, 0x4A, 0x5D, 0x56, 0xC5, 0xE6, 0x07,
+	0xE6, 0x56, 0x42, 0xEE, 0x4F, 0xDF, 0xE0, 0x95, 0x68, 0x5A, 0x92, 0x74, 0xEA, 0x70, 0xF3, 0xA5,
+	0x29, 0x4B, 0x10, 0x3A, 0x07, 0x81, 0x75, 0x4A, 0x78, 0x22, 0xA9, 0x5E, 0x49, 0xCB, 0x27, 0xAC,
+	0x46, 0x45, 0x67, 0xA9, 0x90, 0x74, 0x44, 0x63, 0xBC, 0xDC, 0xC7, 0x43, 0x0B, 0x27, 0x3E, 0x91,
+	0x3B, 0x2D, 0x5D, 0x7E, 0xA7, 0xA4, 0xBE, 0xAB, 0xAA, 0xD8, 0xAC, 0xFB, 0x68, 0x06, 0x92, 0x59,
+	0x04, 0x83, 0x4A, 0xD5, 0x13, 0x3D, 0x76, 0x82, 0x19, 0x54, 0x0A, 0xAB, 0x7E, 0x2E, 0xB5, 0x26,
+	0xC5, 0xFA, 0x12, 0x44, 0x06, 0x8D, 0x18, 0x29, 0xF9, 0x7C, 0x93, 0x31, 0x63, 0x9A, 0x50, 0x5D,
+	0x50, 0x07, 0xD9, 0xE0, 0xBC, 0x58, 0x58, 0xB7, 0x92, 0x12, 0x28, 0xE3, 0x46, 0x37, 0x28, 0x38,
+	0xB1, 0x46, 0x71, 0xEF, 0x29, 0x44, 0x7B, 0x46, 0x7D, 0xEF, 0xB4, 0x70, 0x06, 0x2C, 0x2C, 0x6B,
+	0x18, 0x14, 0x74, 0xD3, 0xB8, 0x2E, 0xDB, 0x3A, 0xB5, 0xBD, 0x00, 0x47, 0x1B, 0x8F, 0xEA, 0xBB,
+	0xAB, 0x48, 0x30, 0x66, 0xFB, 0x07, 0x5D, 0x66, 0x15, 0xE6, 0x66, 0x9E, 0x00, 0xDF, 0x68, 0x56,
+	0x6B, 0x4B, 0xD4, 0x90, 0xAD, 0x8E, 0x18, 0x4A, 0x87, 0x35, 0x6F, 0x41, 0xF2, 0x20, 0xF0, 0xC7,
+	0x14, 0xA6, 0xC6, 0x7C, 0xD3, 0x9C, 0x1D, 0x65, 0xB1, 0xE1, 0xC4, 0x35, 0x2D, 0xF8, 0xC4, 0x99,
+	0xBD, 0x0B, 0xD8, 0xCF, 0xA5, 0x3A, 0x81, 0x1A, 0x69, 0x02, 0xA1, 0xE4, 0x30, 0xC1, 0x82, 0xE3,
+	0x6D, 0xB7, 0xA0, 0x62, 0x6E, 0x82, 0xC3, 0x02, 0xAE, 0xA0, 0xD0, 0xC6, 0x8F, 0x98, 0x43, 0x84,
+	0x10, 0xBE, 0xCB, 0x34, 0x5A, 0x5E, 0x44, 0x58, 0x55, 0xAC, 0x6A, 0x14, 0x19, 0x5D, 0x05, 0x5C,
+	0x8F, 0xA1, 0x7C, 0x8D, 0xED, 0x47, 0x0C, 0x58, 0x37, 0xE3, 0x21, 0xE3, 0xC2, 0xAD, 0x6A, 0x65,
+	0x41, 0xDD, 0x5C, 0xE3, 0xF5, 0x93, 0xD2, 0x07, 0x36, 0x9C, 0x29, 0xD5, 0xA1, 0xE0, 0x33, 0x9E,
+	0x64, 0x6C, 0x33, 0xC7, 0xEA, 0x1E, 0x7D, 0x95, 0x86, 0xFA, 0x68, 0x21, 0x6C, 0x0E, 0xE6, 0x9E,
+	0x2E, 0x7E, 0x59, 0x2C, 0xA1, 0xA3, 0x74, 0x97, 0xB0, 0x56, 0xCD, 0x78, 0xE7, 0x0C, 0x7D, 0x21,
+	0x95, 0xD9, 0x26, 0x27, 0xA7, 0x9C, 0x24, 0x69, 0x0A, 0xFF, 0x8F, 0x55, 0x85, 0x8D, 0x07, 0xCE,
+	0x33, 0x84, 0x15, 0x73, 0xD5, 0xB8, 0xA7, 0xFF, 0xBB, 0x70, 0xD2, 0x53, 0x40, 0xC6, 0xF0, 0x05,
+	0xBB, 0xC1, 0xDB, 0x14, 0xE5, 0x40, 0x6B, 0x9F, 0x80, 0xAD, 0x32, 0x99, 0xA4, 0x3A, 0x44, 0x04,
+	0xE2, 0x72, 0x9D, 0xE5, 0x04, 0x24, 0x81, 0xEF, 0x12, 0x56, 0x52, 0x41, 0xA5, 0xBD, 0x8F, 0x31,
+	0x51, 0xE7, 0xDD, 0x42, 0xC8, 0x67, 0x14, 0xB8, 0xBA, 0xB0, 0xD0, 0xF8, 0x5D, 0xD6, 0x2C, 0xAB,
+	0xD5, 0x50, 0x07, 0x09, 0x75, 0x99, 0xC0, 0x27, 0xE8, 0x87, 0x21, 0x3F, 0x41, 0xE5, 0x6D, 0xE6,
+	0x5C, 0xB2, 0x0D, 0x2F, 0x0D, 0xB6, 0x7A, 0xD9, 0x1A, 0x75, 0x1C, 0x97, 0x5D, 0xF5, 0x6B, 0x95,
+	0xEF, 0xA3, 0xE6, 0xC0, 0xCF, 0x01, 0x6A, 0xC1, 0x30, 0x01, 0xED, 0x7D, 0x31, 0x19, 0x53, 0x76,
+	0x2B, 0x6A, 0xE6, 0xE4, 0xFF, 0x43, 0x08, 0xDB, 0x74, 0xC2, 0xBE, 0x15, 0xC4, 0x36, 0xC1, 0x79,
+	0xE1, 0xAB, 0xF5, 0x19, 0x14, 0x3B, 0xE0, 0x68, 0x25, 0x12, 0x4E, 0x01, 0x9F, 0x99, 0x40, 0xAB,
+	0x1A, 0x7F, 0x99, 0x90, 0x0B, 0xF9, 0xE6, 0x39, 0xFA, 0x02, 0x87, 0x34, 0x44, 0xCA, 0xE4, 0xB0,
+	0xA8, 0xDD, 0xBF, 0x52, 0x0A, 0x31, 0x3A, 0xF9, 0xC8, 0x67, 0x91, 0x8D, 0x50, 0x71, 0x60, 0x35,
+	0xBC, 0x74, 0x61, 0x95, 0x8A, 0x6D, 0x5F, 0x67, 0x92, 0xE0, 0x60, 0x83, 0xE0, 0xCF, 0x82, 0x0A,
+	0xEA, 0x47, 0xFD, 0x59, 0x17, 0xF3, 0x0F, 0x5E, 0xB8, 0x58, 0xD7, 0x74, 0x77, 0x8E, 0xC2, 0x3D,
+	0x97, 0xF8, 0xB8, 0xBC, 0x44, 0x53, 0xA6, 0xCA, 0xDA, 0xB1, 0x6A, 0x4E, 0x09, 0xA8, 0x73, 0x39,
+	0x80, 0xD7, 0x19, 0x84, 0x3E, 0xA5, 0x3E, 0x32, 0x28, 0x9C, 0x70, 0x46, 0x44, 0x51, 0xE4, 0x45,
+	0x8F, 0x1D, 0x83, 0xD1, 0x3F, 0x84, 0x79, 0xB0, 0x86, 0x10, 0x3D, 0x7F, 0x3A, 0xEB, 0x6A, 0x06,
+	0x02, 0x34, 0xE9, 0x1C, 0x2C, 0x35, 0x34, 0x25, 0x86, 0x77, 0x4B, 0x33, 0x84, 0x35, 0x31, 0x95,
+	0x7E, 0x58, 0x74, 0xF4, 0xA3, 0x8E, 0x79, 0xB3, 0x5B, 0x1E, 0x2A, 0x78, 0x2C, 0xC5, 0x75, 0x1E,
+	0x79, 0xA9, 0x2B, 0x75, 0xF1, 0x29, 0x02, 0x96, 0xE7, 0x46, 0x8F, 0xCD, 0xD1, 0x83, 0x0F, 0xE5,
+	0x16, 0x02, 0x8F, 0xA8, 0x58, 0x1C, 0xBA, 0x86, 0xF0, 0x1B, 0xCB, 0xC1, 0x23, 0x8C, 0x7E, 0xD9,
+	0x0D, 0x15, 0x85, 0x97, 0x9B, 0x04, 0x5D, 0x6B, 0x1A, 0x85, 0x15, 0x7D, 0x6A, 0x05, 0xED, 0x51,
+	0x6A, 0xFF, 0x8B, 0x97, 0x42, 0x0D, 0x14, 0x31, 0x0C, 0x75, 0x65, 0xE5, 0x78, 0x43, 0x78, 0xD8,
+	0x65, 0x87, 0x67, 0x23, 0x6D, 0x26, 0x2D, 0xF0, 0x05, 0xE8, 0x38, 0x0B, 0xBA, 0xD1, 0x15, 0xEC,
+	0x87, 0x1E, 0x58, 0x2C, 0xA6, 0x1C, 0x3C, 0xD7, 0xC7, 0xBA, 0x82, 0xD6, 0xDC, 0x0B, 0x21, 0xFC,
+	0xA8, 0x12, 0x8A, 0x40, 0xD3, 0xB9, 0x52, 0xB7, 0x5E, 0x76, 0xD0, 0x6C, 0xDC, 0x9A, 0x33, 0x4D,
+	0x98, 0xEF, 0x49, 0x3A, 0x86, 0x49, 0x0F, 0xE5, 0xF8, 0xBD, 0x57, 0xAF, 0x2A, 0xA8, 0x70, 0x55,
+	0x19, 0x8B, 0xB9, 0x7D, 0x05, 0x02, 0xEE, 0x1B, 0x3A, 0x79, 0xD8, 0x87, 0x8F, 0x20, 0x56, 0x59,
+	0x22, 0xD9, 0x5A, 0x3F, 0x50, 0x49, 0x41, 0x28, 0x8D, 0x1F, 0x06, 0x0E, 0x9B, 0xC0, 0xFB, 0xFD,
+	0xCA, 0xA3, 0x0D, 0xAB, 0xAD, 0x97, 0x4B, 0x74, 0x23, 0x82, 0xB7, 0x18, 0x7D, 0xA6, 0xEF, 0xF9,
+	0xE3, 0x64, 0x0D, 0xE1, 0xB8, 0x7D, 0x8F, 0x61, 0x5C, 0xA7, 0xE5, 0x72, 0xBD, 0x6D, 0xC8, 0xBA,
+	0x61, 0x88, 0x22, 0x91, 0x7E, 0xDF, 0x80, 0x2C, 0x8C, 0xAE, 0x80, 0x1B, 0xB8, 0xEE, 0x2E, 0xBE,
+	0xC3, 0x19, 0xC0, 0x60, 0x9B, 0x43, 0xEA, 0x6A, 0xEB, 0x4E, 0xF9, 0xA4, 0x84, 0x6E, 0x52, 0x16,
+	0x60, 0xAC, 0x12, 0x38, 0x5A, 0xF2, 0x8B, 0x3A, 0x1D, 0xD1, 0x35, 0x8C, 0x36, 0xCF, 0x3C, 0x76,
+	0x09, 0x19, 0x58, 0xFD, 0x00, 0xAF, 0xB3, 0xB6, 0xE4, 0xAA, 0xF0, 0xBA, 0x27, 0x52, 0xF5, 0xD3,
+	0x30, 0xB4, 0x82, 0xF7, 0xB0, 0x76, 0xEF, 0x83, 0x7B, 0x08, 0x78, 0x8C, 0x7B, 0x06, 0x11, 0x34,
+	0x0C, 0xC6, 0xFE, 0x89, 0xD4, 0x85, 0x0F, 0x7E, 0x25, 0x08, 0x34, 0x74, 0x3A, 0x5F, 0x5B, 0xD5,
+	0x82, 0x60, 0xA2, 0xC9, 0x18, 0x67, 0x18, 0x85, 0x12, 0x8E, 0x1D, 0xC8, 0xB7, 0x06, 0xF9, 0xFE,
+	0x2D, 0x32, 0x25, 0x7B, 0x34, 0xBA, 0x4F, 0xB5, 0xE4, 0x15, 0xB1, 0x5E, 0x34, 0x00, 0x0D, 0xF0,
+	0x5D, 0x53, 0xB3, 0x5C, 0x37, 0xA7, 0xD6, 0xEE, 0x2C, 0x9F, 0xB2, 0x4A, 0x15, 0x27, 0x22, 0x9A,
+	0x2E, 0xB2, 0x42, 0x17, 0x7F, 0xAB, 0x72, 0xFB, 0x56, 0x4F, 0xED, 0x2E, 0xE4, 0xF6, 0xAD, 0x36,
+	0x00, 0x85, 0x5B, 0x55, 0x70, 0xAB, 0x66, 0xB8, 0xBF, 0x8E, 0x2A, 0xCF, 0x55, 0x30, 0xD7, 0x56,
+	0xB6, 0xB0, 0x4B, 0x4F, 0x6E, 0xC0, 0xFD, 0xEC, 0x9A, 0x63, 0xE6, 0x28, 0xA5, 0xAD, 0xE5, 0x58,
+	0x9B, 0xCD, 0x51, 0xBD, 0xAC, 0x08, 0x8D, 0x9B, 0xFB, 0x72, 0x05, 0xD1, 0xA6, 0xA4, 0x72, 0xEC,
+	0x95, 0x57, 0x9A, 0x5E, 0xA7, 0xBA, 0x61, 0xB4, 0xFB, 0xF0, 0x07, 0xDB, 0x6E, 0xF7, 0x51, 0x49,
+	0x96, 0x58, 0x88, 0xE0, 0x3B, 0x98, 0x43, 0x05, 0xDF, 0x63, 0x2F, 0x42, 0xB5, 0x54, 0xF2, 0x0C,
+	0xAC, 0x4B, 0x5A, 0xD2, 0xA7, 0x8F, 0x24, 0xFA, 0xE4, 0x1A, 0x45, 0xFC, 0xE9, 0x4F, 0xAE, 0xBB,
+	0xCC, 0x4F, 0xEB, 0xFF, 0x78, 0x75, 0x58, 0x58, 0xC0, 0xEE, 0x7D, 0x56, 0x38, 0x84, 0xCB, 0xAA,
+	0x5F, 0x23, 0xEF, 0xC8, 0x69, 0x61, 0xC5, 0x93, 0xE7, 0xBE, 0x46, 0x9E, 0xDC, 0x3A, 0x00, 0x59,
+	0x07, 0xB0, 0x5A, 0xDC, 0xD0, 0x55, 0x19, 0x03, 0x4F, 0xDF, 0xBB, 0xE1, 0xFE, 0xE7, 0xA8, 0x41,
+	0xA4, 0xB0, 0x5E, 0xC1, 0xFB, 0x34, 0x20, 0xA6, 0x4E, 0x55, 0x3F, 0x13, 0xB0, 0xA5, 0xF9, 0x40,
+	0x04, 0xAC, 0x6B, 0x57, 0xBF, 0xFC, 0x1D, 0xC1, 0xE1, 0x72, 0x1D, 0xE0, 0xC5, 0x26, 0x69, 0x5C,
+	0x88, 0xEC, 0x53, 0x84, 0x7D, 0xD1, 0x59, 0x05, 0xB2, 0xC7, 0xE3, 0xF8, 0x64, 0x0D, 0xAA, 0xFF,
+	0x0D, 0x04, 0x4A, 0x22, 0x03, 0x3F, 0xEB, 0x67, 0x85, 0xE1, 0xCF, 0x7E, 0x4E, 0xE3, 0x2B, 0xB3,
+	0x2F, 0x2D, 0xB4, 0x80, 0x62, 0x3D, 0x4B, 0x2F, 0x50, 0x81, 0xE4, 0x12, 0x50, 0x31, 0x6D, 0x67,
+	0x14, 0xAA, 0xB4, 0x46, 0x75, 0x18, 0xA8, 0xB6, 0xAD, 0xF8, 0x62, 0x67, 0x88, 0x33, 0xA9, 0x87,
+	0xBF, 0x12, 0x69, 0x79, 0x0B, 0x09, 0x65, 0x40, 0x42, 0xF9, 0x27, 0x90, 0x50, 0xDE, 0x01, 0x9B,
+	0x46, 0xCD, 0x09, 0x36, 0x89, 0x74, 0x9B, 0x07, 0xB7, 0x95, 0x92, 0xB2, 0x46, 0x49, 0xF9, 0x67,
+	0x50, 0xF2, 0x5B, 0xB8, 0xBB, 0x92, 0x2C, 0xBB, 0xAE, 0xE7, 0xA1, 0xAB, 0x18, 0xFD, 0x5D, 0xEE,
+	0xF9, 0xB9, 0xF6, 0x66, 0xF2, 0x5A, 0xC8, 0x2E, 0xE5, 0x8F, 0x37, 0x60, 0xD5, 0x59, 0x9C, 0xBB,
+	0xE8, 0x4D, 0xDF, 0x20, 0xF9, 0x5B, 0x6F, 0xBA, 0x37, 0x7A, 0x34, 0xDA, 0xA6, 0xB3, 0xFB, 0xBB,
+	0xE6, 0x95, 0xAF, 0xBE, 0xEC, 0x18, 0xBA, 0xC7, 0xD1, 0x7E, 0xBA, 0xC1, 0xAF, 0xE8, 0xF2, 0x6A,
+	0x2B, 0xE8, 0x67, 0x01, 0x2E, 0x55, 0xBE, 0x68, 0x77, 0x76, 0x87, 0x83, 0x03, 0x95, 0xFD, 0xB0,
+	0xF8, 0xE9, 0xCA, 0xED, 0x46, 0x36, 0xE8, 0x3E, 0xC7, 0x85, 0xA0, 0x1C, 0xB4, 0x71, 0x48, 0x00,
+	0xE1, 0x06, 0x86, 0xA5, 0x1D, 0x4D, 0x03, 0x03, 0x08, 0x37, 0xD0, 0x95, 0x87, 0x36, 0x8E, 0x72,
+	0xDD, 0x6E, 0x88, 0xAD, 0x11, 0x6D, 0x1C, 0x61, 0x7B, 0xDD, 0x00, 0xBF, 0x4E, 0xB4, 0x71, 0x8C,
+	0x0F, 0xD0, 0x30, 0x4C, 0xE8, 0x57, 0x76, 0x95, 0x22, 0xF0, 0x2D, 0xDB, 0x34, 0xDD, 0x6E, 0xA2,
+	0x20, 0xA8, 0xAF, 0x0F, 0x71, 0xDD, 0x91, 0xF7, 0x58, 0xC9, 0xD6, 0x74, 0x37, 0x8E, 0xF1, 0xFA,
+	0x3D, 0x26, 0x28, 0x83, 0xD4, 0x80, 0x14, 0x5E, 0x7F, 0x07, 0x60, 0x0D, 0x0F, 0xA1, 0xAA, 0xF9,
+	0xAA, 0x9D, 0xDA, 0x6D, 0x51, 0xE3, 0x95, 0x8D, 0x3B, 0xF0, 0x7E, 0x75, 0x6D, 0xF3, 0xA9, 0xF7,
+	0x21, 0xBC, 0xA3, 0x6F, 0xAB, 0xB5, 0x6F, 0x1D, 0xE5, 0x53, 0xD4, 0x15, 0x51, 0xDF, 0x3A, 0x64,
+	0xB5, 0xAC, 0x0F, 0xC1, 0xBA, 0xEA, 0x5B, 0x07, 0x21, 0x80, 0xCF, 0xBB, 0x9A, 0x80, 0xA1, 0x41,
+	0x8F, 0xCE, 0x9A, 0x14, 0x55, 0x9A, 0x4C, 0x2E, 0xEF, 0xA2, 0xA7, 0xC2, 0x52, 0xED, 0x06, 0x45,
+	0x45, 0x91, 0x67, 0xF3, 0xF9, 0x23, 0x9B, 0xBD, 0x10, 0xD9, 0x0A, 0x50, 0xF0, 0x65, 0x08, 0xE3,
+	0xD6, 0x33, 0x16, 0x4C, 0xF0, 0x43, 0xBA, 0x34, 0x0C, 0x19, 0x1B, 0x70, 0x74, 0x71, 0xEE, 0xF7,
+	0x20, 0xEA, 0x46, 0x39, 0x1A, 0x7B, 0x11, 0xF3, 0x5F, 0x8A, 0xF1, 0x2D, 0xE1, 0xAE, 0xF1, 0x99,
+	0xED, 0x63, 0x4F, 0x52, 0xB3, 0x26, 0x81, 0x80, 0xCF, 0x34, 0xC1, 0x92, 0x99, 0x74, 0x0A, 0x31,
+	0x0E, 0xCE, 0x5E, 0x51, 0x9A, 0xB2, 0xCA, 0x99, 0x7A, 0x50, 0x60, 0xAE, 0x93, 0xBB, 0x2E, 0xB3,
+	0x64, 0x2E, 0x8E, 0x63, 0x81, 0xEF, 0x0F, 0x55, 0x29, 0xF2, 0x5C, 0x2C, 0xBC, 0xB2, 0xA3, 0xEF,
+	0x4F, 0x73, 0x50, 0xF0, 0xB9, 0xCB, 0x02, 0xCD, 0x6F, 0xB2, 0x1D, 0x60, 0xC1, 0x5E, 0x98, 0xCB,
+	0xDA, 0x4D, 0x5E, 0x5C, 0xAA, 0x97, 0xFE, 0xAF, 0x4F, 0x58, 0x5B, 0x3F, 0x2A, 0xBC, 0x84, 0xD3,
+	0x97, 0xF7, 0xCA, 0xCB, 0xFE, 0x67, 0xBE, 0xE6, 0xE5, 0xA4, 0x48, 0x96, 0xD2, 0xFB, 0x59, 0xEE,
+	0xD3, 0xDB, 0x08, 0xC2, 0x63, 0x1F, 0xA6, 0xDE, 0x9F, 0xE7, 0x9B, 0x7D, 0x99, 0xEF, 0xAF, 0x4A,
+	0xB1, 0x9F, 0xC8, 0x7D, 0x9C, 0x6C, 0xFF, 0x3A, 0x5F, 0x15, 0xFB, 0xB0, 0xFF, 0x79, 0x1E, 0x97,
+	0xFD, 0x0E, 0x6E, 0xA4, 0xF9, 0xA9, 0x81, 0x7E, 0xA8, 0x68, 0x5D, 0x5C, 0xEF, 0xF2, 0xD3, 0xBC,
+	0xCC, 0xC4, 0xCA, 0xD5, 0xE7, 0xF4, 0x10, 0x92, 0x71, 0xB6, 0x4E, 0x30, 0xC7, 0x04, 0x34, 0xA6,
+	0x02, 0x78, 0x73, 0x4D, 0xAA, 0xC3, 0x7F, 0x3F, 0xF9, 0xDB, 0xD5, 0x5C, 0xC0, 0x3F, 0xAB, 0x80,
+	0xD7, 0x41, 0x73, 0x95, 0xDA, 0xD6, 0xD5, 0x13, 0x72, 0x43, 0xD6, 0xB9, 0xFA, 0x37, 0x55, 0xCC,
+	0xCA, 0xED, 0x49, 0xBE, 0xCA, 0xA4, 0xBB, 0x8D, 0xC5, 0xA4, 0x04, 0xC8, 0x5F, 0xE1, 0xFF, 0x71,
+	0x15, 0xA0, 0xB8, 0xFE, 0xCB, 0x2A, 0x7F, 0xBB, 0x7E, 0x1D, 0xB7, 0x23, 0x33, 0x36, 0x32, 0x99,
+	0x84, 0x64, 0xE4, 0xFD, 0x55, 0x13, 0xB2, 0xDA, 0x78, 0x04, 0x60, 0x5E, 0xF8, 0xBD, 0xB7, 0xE7,
+	0x55, 0xDD, 0x38, 0xBF, 0xF8, 0x5B, 0x93, 0x63, 0x66, 0x39, 0x31, 0xD7, 0x29, 0xF7, 0xF4, 0x38,
+	0x9B, 0xD4, 0xBC, 0xFB, 0x3C, 0x07, 0x51, 0x07, 0x5F, 0xA5, 0x67, 0xE2, 0x1D, 0x16, 0x32, 0x9A,
+	0x4C, 0xAE, 0x9D, 0xA1, 0x47, 0x0F, 0x5D, 0x83, 0x45, 0x83, 0x6E, 0xF0, 0x86, 0x8A, 0xEB, 0x53,
+	0x91, 0x82, 0x61, 0x81, 0xFD, 0x45, 0x3D, 0xFC, 0xFB, 0x2F, 0x78, 0x27, 0x2C, 0xAE, 0xD4, 0x53,
+	0xDB, 0x0C, 0xED, 0x51, 0xA4, 0xC3, 0x47, 0x16, 0x8E, 0x27, 0x3A, 0x06, 0x7F, 0x1C, 0xC6, 0x6C,
+	0xC3, 0xA4, 0x25, 0xC3, 0xE3, 0x45, 0x49, 0x45, 0x13, 0x89, 0x26, 0x0D, 0x41, 0x28, 0xD3, 0x17,
+	0x39, 0xFD, 0xDD, 0x0F, 0x02, 0x1F, 0xB4, 0x13, 0x97, 0x51, 0x4C, 0xE8, 0xFA, 0xDB, 0xCA, 0x52,
+	0xED, 0xAA, 0xC3, 0x96, 0x2B, 0xCC, 0xB9, 0xB9, 0xFA, 0xD6, 0x35, 0x25, 0x26, 0x3A, 0x61, 0xED,
+	0xEF, 0xE5, 0x4C, 0xC7, 0x67, 0xAD, 0xDB, 0x6D, 0x41, 0x88, 0xD5, 0x76, 0x4B, 0x95, 0x00, 0xFA,
+	0xAD, 0x34, 0xC8, 0x68, 0xCE, 0x91, 0xEA, 0x56, 0x24, 0x55, 0x22, 0xC2, 0x7B, 0x5C, 0x8D, 0x84,
+	0x30, 0xCF, 0xA1, 0xB7, 0xA2, 0xA3, 0xC1, 0x23, 0x38, 0xEB, 0x5B, 0x61, 0x36, 0xE6, 0x39, 0xB9,
+	0xCA, 0x28, 0xDB, 0xAC, 0x99, 0xF7, 0x17, 0x79, 0xB0, 0x59, 0x25, 0xAB, 0x5C, 0x22, 0xDC, 0x92,
+	0x52, 0xA5, 0xAE, 0x2A, 0x4A, 0x4E, 0x1F, 0x41, 0x4A, 0xFA, 0x96, 0x09, 0x3D, 0xE5, 0x41, 0x9A,
+	0x32, 0x24, 0x28, 0x66, 0x71, 0xB7, 0x5F, 0x05, 0x51, 0x77, 0xC3, 0x95, 0x8F, 0x47, 0x0C, 0xBC,
+	0x9F, 0x66, 0x3A, 0xBF, 0x4F, 0xD0, 0x2E, 0xF7, 0x8F, 0xC5, 0x48, 0xEE, 0x8D, 0x64, 0xF5, 0x1C,
+	0x13, 0xB0, 0x4A, 0x1C, 0xD3, 0x73, 0x33, 0xD0, 0x89, 0xCF, 0xFC, 0x27, 0x92, 0x7A, 0x32, 0xEF,
+	0x59, 0x24, 0x68, 0x77, 0xF6, 0x58, 0xBF, 0x49, 0x01, 0xA9, 0xC2, 0x44, 0x97, 0x46, 0xD0, 0xBB,
+	0x00, 0x89, 0xFA, 0x3C, 0x4D, 0xC3, 0x77, 0xC7, 0x0A, 0xC8, 0xDD, 0x65, 0xFC, 0x1B, 0x32, 0xEF,
+	0xB8, 0x1B, 0xC3, 0x49, 0x00, 0x00,
+};
+
+static const char main_js_name_P[] PROGMEM = "main.js";
+static const char main_js_etag[] = "\"fb28ef4f\"";
+
+/// main.xhtml, 1205 bytes compressed from 6027.
+static const uint8_t main_xhtml_P[] PROGMEM =
+{
+	0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x58, 0x4D, 0x6F, 0xDB, 0x38,
+	0x10, 0x3D, 0xBB, 0x40, 0xFF, 0x03, 0x97, 0xC0, 0xA2, 0x27, 0x5B, 0xB6, 0xDB, 0xA2, 0x89, 0x57,
+	0x52, 0x10, 0x74, 0x11, 0xEC, 0x61, 0xB1, 0x39, 0x24, 0x9B, 0xAB, 0x41, 0x4B, 0xB4, 0xC4, 0x86,
+	0x12, 0xB5, 0x24, 0x25, 0xDB, 0xFD, 0xF5, 0x3B, 0x14, 0x45, 0x7D, 0xD8, 0x4E, 0x94, 0x62, 0x0B,
+	0xEC, 0xC5, 0x17, 0x89, 0x9A, 0x79, 0x33, 0x8F, 0x33, 0xE4, 0x90, 0x03, 0xF9, 0x37, 0xFB, 0x8C,
+	0xA3, 0x8A, 0x4A, 0xC5, 0x44, 0x1E, 0x7C, 0x58, 0xCC, 0xE6, 0x1F, 0x6E, 0xC2, 0xF7, 0xEF, 0xFC,
+	0x54, 0x83, 0x98, 0x93, 0x3C, 0x09, 0x30, 0xCD, 0x31, 0x02, 0x50, 0xAE, 0x02, 0x9C, 0x6A, 0x5D,
+	0xAC, 0x3C, 0x6F, 0xB7, 0xDB, 0xCD, 0x76, 0x1F, 0x67, 0x42, 0x26, 0xDE, 0xE2, 0xFA, 0xFA, 0xDA,
+	0xDB, 0x1B, 0x74, 0x03, 0x5A, 0xA9, 0x2A, 0x39, 0x07, 0x5C, 0xCE, 0xE7, 0x73, 0x0F, 0x74, 0x18,
+	0xBC, 0x4F, 0xFC, 0x94, 0x92, 0xD8, 0x0C, 0x26, 0x7E, 0x46, 0x35, 0x41, 0x06, 0x3E, 0xA5, 0xFF,
+	0x94, 0xAC, 0x0A, 0xF0, 0x57, 0x91, 0x6B, 0x9A, 0xEB, 0xE9, 0xE3, 0xA1, 0xA0, 0x18, 0x45, 0xF6,
+	0x2B, 0xC0, 0x9A, 0xEE, 0xB5, 0x25, 0xFA, 0x0D, 0x45, 0x29, 0x91, 0x8A, 0xEA, 0xE0, 0xEF, 0xC7,
+	0xBB, 0xE9, 0x15, 0xF6, 0xAC, 0x23, 0xCD, 0x34, 0xA7, 0xE1, 0xBD, 0x8A, 0x18, 0xE7, 0x42, 0x45,
+	0xA2, 0xA0, 0xBE, 0x67, 0x65, 0xB5, 0x9A, 0xB3, 0xFC, 0x19, 0x49, 0xCA, 0x03, 0xAC, 0xF4, 0x81,
+	0x53, 0x95, 0x52, 0xAA, 0x31, 0xD2, 0x40, 0xD2, 0xF8, 0x8E, 0x94, 0xC2, 0x28, 0x95, 0x74, 0x1B,
+	0xE0, 0x8C, 0xB0, 0x7C, 0x06, 0xDF, 0x37, 0x55, 0x40, 0x3E, 0x7E, 0xF9, 0xB2, 0x21, 0xF3, 0x96,
+	0x45, 0x45, 0x92, 0x15, 0xBA, 0x6F, 0xF7, 0x8D, 0x54, 0xC4, 0x4A, 0x31, 0x52, 0x32, 0x6A, 0xAC,
+	0xBF, 0x19, 0xE3, 0xED, 0x66, 0x79, 0x45, 0xB7, 0x9F, 0xB6, 0x38, 0xF4, 0x3D, 0x0B, 0xA9, 0x83,
+	0xF7, 0x5C, 0xF4, 0xFE, 0x46, 0xC4, 0x87, 0x70, 0x52, 0x3B, 0x8E, 0x59, 0x85, 0x58, 0x0C, 0xB3,
+	0x8B, 0x24, 0x85, 0x8C, 0xD7, 0x6C, 0x40, 0x57, 0x25, 0x26, 0xA1, 0xB5, 0x26, 0x66, 0xAA, 0xE0,
+	0xE4, 0xD0, 0xA8, 0xAC, 0x0E, 0xA2, 0xA2, 0x28, 0xE2, 0x44, 0xC1, 0xE2, 0x90, 0x3D, 0x83, 0x08,
+	0xF6, 0x8B, 0x00, 0x7F, 0x9E, 0xFF, 0x8A, 0xD1, 0x01, 0x06, 0xE6, 0xBD, 0x5F, 0x3A, 0x01, 0x0C,
+	0x16, 0x73, 0x33, 0xF2, 0xC6, 0x5D, 0x38, 0x0F, 0x9F, 0x9D, 0x0B, 0x6B, 0x79, 0x70, 0xCE, 0x1A,
+	0x17, 0xBE, 0xD7, 0xCC, 0xB0, 0xF9, 0xFC, 0x65, 0x3A, 0x45, 0x8F, 0x29, 0x45, 0x3B, 0x52, 0xD1,
+	0xAD, 0x90, 0x99, 0x42, 0x44, 0x52, 0x14, 0x4B, 0xB2, 0xCB, 0x91, 0x80, 0x5D, 0x86, 0x34, 0x28,
+	0x13, 0xC9, 0xE2, 0x19, 0x9A, 0x4E, 0x1B, 0x9B, 0x88, 0xE4, 0x90, 0xC1, 0x3A, 0xC4, 0xD6, 0x0C,
+	0xA3, 0x1D, 0x8B, 0x75, 0x6A, 0xC8, 0xE6, 0xB0, 0x2A, 0x94, 0x25, 0xA9, 0xB6, 0x1F, 0x90, 0x4A,
+	0x6B, 0x60, 0xD7, 0xC3, 0x83, 0xBC, 0xD9, 0x91, 0xA1, 0xBE, 0x13, 0x12, 0x7D, 0x4D, 0x49, 0x9E,
+	0x53, 0x8E, 0x16, 0x8E, 0xA1, 0x4D, 0x6D, 0x64, 0x35, 0xCA, 0x25, 0xD7, 0xC8, 0x9B, 0xC0, 0x1B,
+	0x15, 0xEE, 0xE3, 0x16, 0x6D, 0xA6, 0x7B, 0xC0, 0x9C, 0x64, 0x14, 0x87, 0x2D, 0x47, 0xC7, 0x0F,
+	0xB0, 0x4D, 0xF8, 0x24, 0xB8, 0x56, 0xDE, 0xEF, 0xAC, 0x5A, 0xF9, 0xDE, 0x26, 0xF4, 0x59, 0x5E,
+	0x94, 0xFD, 0xBD, 0x82, 0x51, 0x46, 0xF6, 0x9C, 0xE6, 0x89, 0x89, 0xEC, 0x23, 0x6C, 0x17, 0xF6,
+	0x9D, 0xD6, 0x83, 0x8A, 0xF0, 0x12, 0x46, 0x0B, 0xEC, 0x68, 0x2A, 0x70, 0x8B, 0x91, 0x21, 0x6B,
+	0xC6, 0xDD, 0x92, 0x51, 0x4E, 0x23, 0xDD, 0x53, 0x95, 0x39, 0xD3, 0x6E, 0xA6, 0x13, 0x5F, 0x14,
+	0x1A, 0x0A, 0xD9, 0x39, 0x7C, 0xC2, 0xE1, 0x93, 0xEF, 0x59, 0xD9, 0x0B, 0x90, 0x0C, 0x30, 0xD9,
+	0x31, 0x08, 0x96, 0xB5, 0xA6, 0x69, 0x23, 0x93, 0x5E, 0x17, 0xE4, 0x23, 0xCB, 0xE8, 0xCF, 0x88,
+	0x51, 0xF7, 0x62, 0xD4, 0x2F, 0xC7, 0xA8, 0x47, 0x62, 0x7C, 0xC0, 0xE1, 0xC3, 0x4B, 0x31, 0x5A,
+	0x47, 0xD4, 0x94, 0x55, 0x33, 0x6A, 0xE6, 0x81, 0x02, 0x84, 0x33, 0xB0, 0xCC, 0x1E, 0x5E, 0x4D,
+	0x8F, 0x81, 0x95, 0x00, 0x2B, 0x1F, 0x7E, 0x24, 0x41, 0x0F, 0x24, 0x2B, 0xA0, 0xAA, 0x92, 0x3A,
+	0x3F, 0x46, 0x83, 0xAC, 0x8A, 0xE6, 0x64, 0xC3, 0x69, 0x3C, 0x48, 0x59, 0x94, 0xD2, 0xE8, 0x79,
+	0x23, 0xF6, 0x6D, 0x56, 0x1A, 0x90, 0x4B, 0x8C, 0xFB, 0xF4, 0xC2, 0x1E, 0x87, 0x24, 0x9A, 0xAE,
+	0xCE, 0x64, 0xBE, 0x71, 0xA1, 0x1A, 0xFE, 0xB5, 0xC1, 0x39, 0x47, 0x43, 0xE1, 0xC0, 0x9D, 0x5D,
+	0xAD, 0xD5, 0xDB, 0x97, 0xB2, 0xE1, 0x91, 0x34, 0x12, 0x32, 0x5E, 0x5B, 0x84, 0xE3, 0x19, 0x0A,
+	0x07, 0x3C, 0x31, 0x8D, 0x58, 0x46, 0x4C, 0x16, 0x7F, 0x9C, 0xAB, 0xB3, 0x75, 0x44, 0x3D, 0xC9,
+	0x80, 0x05, 0x8E, 0x10, 0x49, 0x12, 0x88, 0x74, 0x84, 0x64, 0x79, 0x4A, 0xD2, 0x9A, 0x3A, 0x8E,
+	0x4E, 0x30, 0xA0, 0x60, 0x70, 0x27, 0x49, 0x4E, 0x49, 0x35, 0xCE, 0xB2, 0x38, 0x65, 0xE9, 0x5B,
+	0x3B, 0xA2, 0x81, 0x6C, 0xB8, 0xD6, 0x54, 0x09, 0x5E, 0xD6, 0x49, 0x3B, 0x57, 0x1D, 0x9D, 0x1A,
+	0xBF, 0x79, 0xF3, 0x07, 0xF8, 0x0A, 0x87, 0x57, 0x68, 0xC3, 0xB4, 0x1A, 0x39, 0x1C, 0x16, 0x70,
+	0xDE, 0x2E, 0xE6, 0xE7, 0x90, 0x6D, 0x01, 0xF4, 0xA6, 0x5A, 0x50, 0xF2, 0x8C, 0x62, 0xAA, 0x41,
+	0xFC, 0xFA, 0x1E, 0x37, 0xC0, 0xB5, 0x05, 0xBA, 0x04, 0xF4, 0x45, 0xC3, 0xF8, 0x05, 0xE7, 0xAF,
+	0x7B, 0x33, 0x88, 0x76, 0xF7, 0x99, 0xF1, 0xC0, 0x3E, 0x12, 0x59, 0x01, 0x49, 0x52, 0x63, 0x75,
+	0xD7, 0xE1, 0x9C, 0xAF, 0x9E, 0x64, 0xE0, 0xD1, 0x1C, 0x81, 0x92, 0x25, 0x09, 0x95, 0x6D, 0x81,
+	0x5B, 0xC5, 0xFD, 0x5F, 0xDE, 0xFD, 0xDD, 0xDD, 0xEB, 0x34, 0x22, 0x17, 0xDB, 0x6D, 0x7B, 0xEA,
+	0x59, 0x37, 0xEB, 0xE3, 0x2D, 0xAC, 0x38, 0x74, 0x2F, 0x6E, 0xB9, 0xFB, 0xEE, 0x24, 0x89, 0x99,
+	0xE8, 0x0E, 0xD0, 0xC6, 0xBC, 0x2C, 0x8E, 0x1D, 0x82, 0xC4, 0x0B, 0xCB, 0xE2, 0xCD, 0x1E, 0x62,
+	0xB1, 0xCB, 0x8F, 0x7D, 0xD4, 0x32, 0x2F, 0x34, 0xAF, 0xC1, 0x59, 0x51, 0x51, 0x3E, 0xB2, 0xE7,
+	0x3F, 0xF5, 0xF6, 0xBC, 0xB9, 0x4F, 0x9D, 0xC7, 0xDA, 0xF6, 0x98, 0xC6, 0x0A, 0x3D, 0xB8, 0xA7,
+	0x0C, 0xC9, 0xC4, 0xA5, 0xB8, 0xD4, 0x1A, 0xB6, 0x61, 0x53, 0x85, 0x45, 0xC1, 0xA1, 0xED, 0xB9,
+	0x35, 0x2F, 0x48, 0x79, 0xAD, 0x3A, 0x73, 0x35, 0xD7, 0x7D, 0x1D, 0x5C, 0x06, 0xE6, 0x35, 0xB8,
+	0x97, 0xDB, 0xD6, 0xCA, 0x68, 0xD6, 0x19, 0xCD, 0xCB, 0xB6, 0x56, 0xFE, 0xAC, 0x9B, 0x1F, 0xC1,
+	0x85, 0x5C, 0x21, 0x57, 0x02, 0x83, 0xFA, 0xAA, 0x75, 0x2D, 0xFC, 0xA4, 0xB6, 0xCC, 0x05, 0x71,
+	0x52, 0x5D, 0x12, 0xC6, 0x21, 0x3C, 0x8E, 0x8B, 0xEB, 0xB8, 0xBA, 0x36, 0xF0, 0xC4, 0xA1, 0x79,
+	0x8E, 0x21, 0x13, 0xDB, 0x13, 0xD6, 0xAF, 0x93, 0x92, 0x3D, 0x53, 0x89, 0x36, 0xAE, 0x3A, 0xDE,
+	0xD5, 0x99, 0xB0, 0xCC, 0xAC, 0x4D, 0xDB, 0xB7, 0x6E, 0x52, 0xF6, 0x02, 0x6B, 0x0E, 0x9D, 0x18,
+	0x81, 0x05, 0x3B, 0x1B, 0x6C, 0x68, 0xB5, 0x63, 0x33, 0x8F, 0x09, 0x74, 0xDA, 0x80, 0xB6, 0xEF,
+	0xD1, 0x8C, 0x08, 0x0E, 0x58, 0xF3, 0x7C, 0x31, 0x4A, 0x77, 0xFC, 0xB4, 0xEB, 0xDB, 0x1F, 0x8E,
+	0x74, 0x74, 0xCB, 0xF1, 0x8E, 0x6E, 0x79, 0xE9, 0xE8, 0x2E, 0x1D, 0xDD, 0xA5, 0xA3, 0xBB, 0x74,
+	0x74, 0x97, 0x8E, 0xEE, 0xD2, 0xD1, 0x5D, 0x3A, 0xBA, 0xFF, 0xDE, 0xD1, 0xBD, 0xB9, 0xA1, 0x9B,
+	0xFC, 0xBF, 0x1D, 0xDD, 0x5B, 0x7B, 0xB7, 0x57, 0x3B, 0xBF, 0x4B, 0x47, 0xF7, 0x73, 0x3B, 0xBA,
+	0xDE, 0xC8, 0x2D, 0xF9, 0x56, 0x08, 0x38, 0x58, 0xDB, 0xFF, 0xA3, 0x05, 0xC9, 0x43, 0x9F, 0x34,
+	0xFF, 0x6D, 0x53, 0xCA, 0x8B, 0x59, 0xAA, 0x33, 0x1C, 0xFE, 0x01, 0x23, 0xDF, 0x23, 0xE6, 0xBF,
+	0xAB, 0x41, 0x9C, 0x03, 0x93, 0x8D, 0xB6, 0xD8, 0xDB, 0x8D, 0x28, 0xF5, 0x09, 0xD8, 0xF1, 0x69,
+	0x49, 0x72, 0xC5, 0x94, 0x26, 0xC0, 0x89, 0x6E, 0x51, 0xC7, 0x65, 0xFF, 0x70, 0x77, 0xEA, 0x19,
+	0x9C, 0x2E, 0x38, 0xEC, 0xBE, 0x8D, 0x47, 0x14, 0x49, 0x5A, 0x5F, 0x68, 0xB3, 0x33, 0x31, 0xC1,
+	0xCE, 0x37, 0xBF, 0x7F, 0xDF, 0xBF, 0xF3, 0x3D, 0xF3, 0x5B, 0x3B, 0xFC, 0x17, 0xC1, 0xEB, 0x02,
+	0x80, 0x8B, 0x17, 0x00, 0x00,
+};
+
+static const char main_xhtml_name_P[] PROGMEM = "main.xhtml";
+static const char main_xhtml_etag[] = "\"d8ae2ee3\"";
+
+/// The assets mirrored in program memory.
+static const asset_t assets_P[] PROGMEM =
+{
+	{ main_css_name_P, main_css_P, sizeof(main_css_P), main_css_etag, ASSET_CSS },
+	{ main_js_name_P, main_js_P, sizeof(main_js_P), main_js_etag, ASSET_JAVASCRIPT },
+	{ main_xhtml_name_P, main_xhtml_P, sizeof(main_xhtml_P), main_xhtml_etag, ASSET_XHTML },
+};
+
+#endif /* WEB_ASSETS_H_ */